@@ -13,6 +13,7 @@
 
 #include <Ext/TechnoType/Body.h>
 #include <Ext/Techno/Body.h>
+#include <Ext/Script/Body.h>
 
 const char* ObjectInfoCommandClass::GetName() const
 {
@@ -85,20 +86,9 @@ void ObjectInfoCommandClass::Execute(WWKey eInput) const
 		{
 			auto pTeam = pFoot->Team;
 
-			auto pTeamType = pFoot->Team->Type;
-			bool found = false;
-			for (int i = 0; i < AITriggerTypeClass::Array->Count && !found; i++)
-			{
-				auto pTriggerTeam1Type = AITriggerTypeClass::Array->GetItem(i)->Team1;
-				auto pTriggerTeam2Type = AITriggerTypeClass::Array->GetItem(i)->Team2;
-
-				if (pTeamType && ((pTriggerTeam1Type && pTriggerTeam1Type == pTeamType) || (pTriggerTeam2Type && pTriggerTeam2Type == pTeamType)))
-				{
-					found = true;
-					auto pTriggerType = AITriggerTypeClass::Array->GetItem(i);
-					append("Trigger ID = %s, weights [Current, Min, Max]: %f, %f, %f", pTriggerType->ID, pTriggerType->Weight_Current, pTriggerType->Weight_Minimum, pTriggerType->Weight_Maximum);
-				}
-			}
+			if (auto const pTriggerType = ScriptExt::FindTriggerTypeForTeam(pTeam->Type))
+				append("Trigger ID = %s, weights [Current, Min, Max]: %f, %f, %f", pTriggerType->ID, pTriggerType->Weight_Current, pTriggerType->Weight_Minimum, pTriggerType->Weight_Maximum);
+
 			display();
 
 			append("Team ID = %s, Script ID = %s, Taskforce ID = %s",
@@ -0,0 +1,39 @@
+#include "ToggleProfiler.h"
+
+#include <Utilities/GeneralUtils.h>
+#include <Utilities/Profiler.h>
+
+const char* ToggleProfilerCommandClass::GetName() const
+{
+	return "Toggle Profiler";
+}
+
+const wchar_t* ToggleProfilerCommandClass::GetUIName() const
+{
+	return GeneralUtils::LoadStringUnlessMissing("TXT_TOGGLE_PROFILER", L"Toggle Profiler");
+}
+
+const wchar_t* ToggleProfilerCommandClass::GetUICategory() const
+{
+	return CATEGORY_DEVELOPMENT;
+}
+
+const wchar_t* ToggleProfilerCommandClass::GetUIDescription() const
+{
+	return GeneralUtils::LoadStringUnlessMissing("TXT_TOGGLE_PROFILER_DESC", L"Start profiling Phobos hooks, or stop and write the results to a file.");
+}
+
+void ToggleProfilerCommandClass::Execute(WWKey eInput) const
+{
+	if (!Profiler::Enabled)
+	{
+		Profiler::Start();
+		Debug::LogAndMessage("Profiler started.\n");
+	}
+	else
+	{
+		Profiler::Stop();
+		Profiler::Dump("PhobosProfile.csv");
+		Debug::LogAndMessage("Profiler stopped, results written to PhobosProfile.csv.\n");
+	}
+}
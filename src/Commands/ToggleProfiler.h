@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Commands.h"
+
+// Start or stop profiling Phobos hooks and dump the results
+class ToggleProfilerCommandClass : public CommandClass
+{
+public:
+	virtual const char* GetName() const override;
+	virtual const wchar_t* GetUIName() const override;
+	virtual const wchar_t* GetUICategory() const override;
+	virtual const wchar_t* GetUIDescription() const override;
+	virtual void Execute(WWKey eInput) const override;
+};
@@ -46,6 +46,10 @@ public:
 
 		virtual ~ExtData() = default;
 
+		// Bullets come and go constantly, their extensions reuse freed blocks.
+		static void* operator new(size_t size) { return ObjectPool<ExtData>::Allocate(size); }
+		static void operator delete(void* ptr, size_t size) { ObjectPool<ExtData>::Free(ptr, size); }
+
 		virtual void InvalidatePointer(void* ptr, bool bRemoved) override { }
 
 		virtual void LoadFromStream(PhobosStreamReader& Stm) override;
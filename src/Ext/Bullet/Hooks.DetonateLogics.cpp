@@ -501,7 +501,11 @@ DEFINE_HOOK(0x469EC0, BulletClass_Logics_AirburstWeapon, 0x6)
 		}
 		else
 		{
-			for (auto const pTechno : *TechnoClass::Array)
+			// Only technos near the target can be in range, in the same order a full TechnoClass::Array scan gives.
+			std::vector<TechnoClass*> candidates;
+			TechnoExt::GetTechnosNear(candidates, coordsTarget, static_cast<int>(pTypeExt->Splits_TargetingDistance.Get()));
+
+			for (auto const pTechno : candidates)
 			{
 				if (pTechno->IsInPlayfield && pTechno->IsOnMap && pTechno->Health > 0 && (pTypeExt->RetargetSelf || pTechno != pThis->Owner))
 				{
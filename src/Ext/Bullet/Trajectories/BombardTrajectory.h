@@ -32,6 +32,9 @@ public:
 		, Speed { trajType->Trajectory_Speed }
 	{ }
 
+	static void* operator new(size_t size) { return ObjectPool<BombardTrajectory>::Allocate(size); }
+	static void operator delete(void* ptr, size_t size) { ObjectPool<BombardTrajectory>::Free(ptr, size); }
+
 	virtual bool Load(PhobosStreamReader& Stm, bool RegisterForChange) override;
 	virtual bool Save(PhobosStreamWriter& Stm) const override;
 	virtual TrajectoryFlag Flag() const override { return TrajectoryFlag::Bombard; }
@@ -2,6 +2,7 @@
 
 #include <Utilities/TemplateDef.h>
 #include <Utilities/Savegame.h>
+#include <Utilities/ObjectPool.h>
 
 #include <BulletClass.h>
 
@@ -39,6 +39,9 @@ public:
 		, TargetZPosition { 0 }
 	{ }
 
+	static void* operator new(size_t size) { return ObjectPool<StraightTrajectory>::Allocate(size); }
+	static void operator delete(void* ptr, size_t size) { ObjectPool<StraightTrajectory>::Free(ptr, size); }
+
 	virtual bool Load(PhobosStreamReader& Stm, bool RegisterForChange) override;
 	virtual bool Save(PhobosStreamWriter& Stm) const override;
 	virtual TrajectoryFlag Flag() const override { return TrajectoryFlag::Straight; }
@@ -4,6 +4,8 @@
 #include <Ext/Scenario/Body.h>
 #include "Ext/Techno/Body.h"
 #include "Ext/Building/Body.h"
+#include <Ext/TEvent/Body.h>
+#include <Ext/WarheadType/Body.h>
 #include <unordered_map>
 
 DEFINE_HOOK(0x508C30, HouseClass_UpdatePower_UpdateCounter, 0x5)
@@ -154,11 +156,22 @@ void __fastcall TechnoClass_UnInit_Wrapper(TechnoClass* pThis)
 DEFINE_JUMP(CALL, 0x4DE60B, GET_OFFSET(TechnoClass_UnInit_Wrapper));   // FootClass
 DEFINE_JUMP(VTABLE, 0x7E3FB4, GET_OFFSET(TechnoClass_UnInit_Wrapper)); // BuildingClass
 
+// Owned counts read by HouseOwnsTechnoType events only change here, including changes that bypass
+// limbo / unlimbo like Ares type conversion. Publishing only bumps a generation, so doing it on entry is fine.
+DEFINE_HOOK_AGAIN(0x5025F0, HouseClass_RegisterGainLoss_PublishOwnership, 0x6) // HouseClass::RegisterLoss
+DEFINE_HOOK(0x502A80, HouseClass_RegisterGainLoss_PublishOwnership, 0x6)       // HouseClass::RegisterGain
+{
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
+	return 0;
+}
+
 DEFINE_HOOK(0x6F6BC9, TechnoClass_Limbo_AddTracking, 0x6)
 {
 	GET(TechnoClass* const, pThis, ESI);
 
 	auto const pType = pThis->GetTechnoType();
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
+	WarheadTypeExt::ClearCellSpreadBatches();
 
 	if (LimboTrackingTemp::Enabled && !pType->Insignificant && !pType->DontScore && !LimboTrackingTemp::IsBeingDeleted)
 	{
@@ -175,6 +188,9 @@ DEFINE_HOOK(0x6F6D85, TechnoClass_Unlimbo_RemoveTracking, 0x6)
 
 	auto const pType = pThis->GetTechnoType();
 	auto const pExt = TechnoExt::ExtMap.Find(pThis);
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
+	WarheadTypeExt::ClearCellSpreadBatches();
+	TechnoExt::QueueTechnoGridUpdate(pThis);
 
 	if (LimboTrackingTemp::Enabled && !pType->Insignificant && !pType->DontScore && pExt->HasBeenPlacedOnMap)
 	{
@@ -201,6 +217,7 @@ DEFINE_HOOK(0x7015C9, TechnoClass_Captured_UpdateTracking, 0x6)
 	auto const pExt = TechnoExt::ExtMap.Find(pThis);
 	auto const pOwnerExt = HouseExt::ExtMap.Find(pThis->Owner);
 	auto const pNewOwnerExt = HouseExt::ExtMap.Find(pNewOwner);
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
 
 	if (LimboTrackingTemp::Enabled && !pType->Insignificant && !pType->DontScore && pThis->InLimbo)
 	{
@@ -10,7 +10,11 @@
 #include <New/Type/DigitalDisplayTypeClass.h>
 #include <New/Type/AttachEffectTypeClass.h>
 
+#include <Ext/TechnoType/Body.h>
+#include <TiberiumClass.h>
+
 std::unique_ptr<RulesExt::ExtData> RulesExt::Data = nullptr;
+int RulesExt::PipLayoutGeneration = 0;
 
 void RulesExt::Allocate(RulesClass* pThis)
 {
@@ -24,6 +28,7 @@ void RulesExt::Remove(RulesClass* pThis)
 
 void RulesExt::LoadFromINIFile(RulesClass* pThis, CCINIClass* pINI)
 {
+	++RulesExt::PipLayoutGeneration;
 	Data->LoadFromINI(pINI);
 }
 
@@ -162,6 +167,7 @@ void RulesExt::ExtData::LoadBeforeTypeData(RulesClass* pThis, CCINIClass* pINI)
 	this->FreeMCV_CreditsThreshold.Read(exINI, GameStrings::CrateRules, "FreeMCV.CreditsThreshold");
 
 	this->ROF_RandomDelay.Read(exINI, GameStrings::CombatDamage, "ROF.RandomDelay");
+	this->BatchCellSpreadDetonations.Read(exINI, GameStrings::CombatDamage, "BatchCellSpreadDetonations");
 
 	this->DisplayIncome.Read(exINI, GameStrings::AudioVisual, "DisplayIncome");
 	this->DisplayIncome_Houses.Read(exINI, GameStrings::AudioVisual, "DisplayIncome.Houses");
@@ -263,6 +269,60 @@ void RulesExt::ExtData::LoadAfterTypeData(RulesClass* pThis, CCINIClass* pINI)
 		return;
 
 	INI_EX exINI(pINI);
+
+	++RulesExt::PipLayoutGeneration;
+	this->ResolveAITargetTypes();
+}
+
+// Pip layouts only depend on type and rules data, so they are resolved once per INI read instead of on every draw.
+void RulesExt::ExtData::ResolveTiberiumPipOrder()
+{
+	if (this->Pips_Tiberiums_ResolvedGeneration == RulesExt::PipLayoutGeneration)
+		return;
+
+	this->Pips_Tiberiums_ResolvedGeneration = RulesExt::PipLayoutGeneration;
+	auto& pipOrder = this->Pips_Tiberiums_ResolvedOrder;
+	auto const rawPipOrder = this->Pips_Tiberiums_DisplayOrder.empty() ? std::vector<int>{ 0, 2, 3, 1 } : this->Pips_Tiberiums_DisplayOrder;
+	pipOrder.clear();
+
+	// First make a new vector, removing all the duplicate and invalid tiberiums
+	for (int index : rawPipOrder)
+	{
+		if (std::find(pipOrder.begin(), pipOrder.end(), index) == pipOrder.end() &&
+			index >= 0 && index < TiberiumClass::Array->Count)
+		{
+			pipOrder.push_back(index);
+		}
+	}
+
+	// Then add any tiberium types that are missing
+	for (int i = 0; i < TiberiumClass::Array->Count; i++)
+	{
+		if (std::find(pipOrder.begin(), pipOrder.end(), i) == pipOrder.end())
+			pipOrder.push_back(i);
+	}
+}
+
+// Marks every techno type with the [AITargetTypes] lists it is part of, so scripts and
+// trigger events can test list membership without scanning the lists.
+void RulesExt::ExtData::ResolveAITargetTypes()
+{
+	const size_t words = (this->AITargetTypesLists.size() + 31) / 32;
+
+	for (auto const pType : *TechnoTypeClass::Array)
+	{
+		if (auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pType))
+			pTypeExt->AITargetTypesListMask.assign(words, 0);
+	}
+
+	for (size_t i = 0; i < this->AITargetTypesLists.size(); i++)
+	{
+		for (auto const pType : this->AITargetTypesLists[i])
+		{
+			if (auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pType))
+				pTypeExt->AITargetTypesListMask[i / 32] |= 1u << (i % 32);
+		}
+	}
 }
 
 // =============================
@@ -347,6 +407,7 @@ void RulesExt::ExtData::Serialize(T& Stm)
 		.Process(this->ForceShield_ExtraTintIntensity)
 		.Process(this->ColorAddUse8BitRGB)
 		.Process(this->ROF_RandomDelay)
+		.Process(this->BatchCellSpreadDetonations)
 		.Process(this->ToolTip_Background_Color)
 		.Process(this->ToolTip_Background_Opacity)
 		.Process(this->ToolTip_Background_BlurSize)
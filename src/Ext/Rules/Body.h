@@ -88,6 +88,8 @@ public:
 		ValueableVector<int> Pips_Tiberiums_DisplayOrder;
 		Valueable<int> Pips_Tiberiums_WeedFrame;
 		Valueable<int> Pips_Tiberiums_WeedEmptyFrame;
+		std::vector<int> Pips_Tiberiums_ResolvedOrder; // Pips_Tiberiums_DisplayOrder with duplicates removed and missing tiberiums appended.
+		int Pips_Tiberiums_ResolvedGeneration;         // RulesExt::PipLayoutGeneration the above was resolved for.
 
 		Valueable<bool> HeightShadowScaling;
 		Valueable<double> HeightShadowScaling_MinScale;
@@ -118,6 +120,7 @@ public:
 		Valueable<bool> ColorAddUse8BitRGB;
 
 		Valueable<PartialVector2D<int>> ROF_RandomDelay;
+		Valueable<bool> BatchCellSpreadDetonations;
 		Valueable<ColorStruct> ToolTip_Background_Color;
 		Valueable<int> ToolTip_Background_Opacity;
 		Valueable<float> ToolTip_Background_BlurSize;
@@ -218,6 +221,8 @@ public:
 			, Pips_Tiberiums_DisplayOrder {}
 			, Pips_Tiberiums_WeedFrame { 1 }
 			, Pips_Tiberiums_WeedEmptyFrame { 0 }
+			, Pips_Tiberiums_ResolvedOrder {}
+			, Pips_Tiberiums_ResolvedGeneration { -1 }
 
 			, HeightShadowScaling { false }
 			, HeightShadowScaling_MinScale { 0.0 }
@@ -242,6 +247,7 @@ public:
 			, ForceShield_ExtraTintIntensity { 0.0 }
 			, ColorAddUse8BitRGB { false }
 			, ROF_RandomDelay { { 0 ,2  } }
+			, BatchCellSpreadDetonations { false }
 			, ToolTip_Background_Color { { 0, 0, 0 } }
 			, ToolTip_Background_Opacity { 100 }
 			, ToolTip_Background_BlurSize { 0.0f }
@@ -300,6 +306,8 @@ public:
 		virtual void SaveToStream(PhobosStreamWriter& Stm) override;
 
 		void ReplaceVoxelLightSources();
+		void ResolveTiberiumPipOrder();
+		void ResolveAITargetTypes();
 
 	private:
 		template <typename T>
@@ -312,6 +320,9 @@ private:
 public:
 	static IStream* g_pStm;
 
+	// Bumped on every rules INI read, pip layouts resolved for an older value are resolved again on next draw.
+	static int PipLayoutGeneration;
+
 	static void Allocate(RulesClass* pThis);
 	static void Remove(RulesClass* pThis);
 
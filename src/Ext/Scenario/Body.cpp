@@ -3,41 +3,250 @@
 #include <SessionClass.h>
 #include <VeinholeMonsterClass.h>
 
+#include <Ext/TEvent/Body.h>
+
 std::unique_ptr<ScenarioExt::ExtData> ScenarioExt::Data = nullptr;
 
 bool ScenarioExt::CellParsed = false;
 
-void ScenarioExt::ExtData::SetVariableToByID(bool bIsGlobal, int nIndex, char bState)
+void ScenarioVariableTable::Define(int index, const char* pName, int value)
 {
-	auto& dict = Global()->Variables[bIsGlobal];
+	Slot* pSlot = nullptr;
 
-	auto itr = dict.find(nIndex);
+	if (IsDenseIndex(index))
+	{
+		if (static_cast<size_t>(index) >= this->Slots.size())
+			this->Slots.resize(index + 1, { 0, -1 });
 
-	if (itr != dict.end() && itr->second.Value != bState)
+		pSlot = &this->Slots[index];
+	}
+	else
 	{
-		itr->second.Value = bState;
-		ScenarioClass::Instance->VariablesChanged = true;
-		if (!bIsGlobal)
-			TagClass::NotifyLocalChanged(nIndex);
+		pSlot = &this->SparseSlots.try_emplace(index, Slot { 0, -1 }).first->second;
+	}
+
+	auto& slot = *pSlot;
+
+	if (slot.NameOffset < 0)
+		this->Count++;
+
+	// Redefined names are appended, the pool is only compacted on Clear().
+	slot.NameOffset = static_cast<int>(this->NamePool.size());
+	slot.Value = value;
+	this->NamePool.insert(this->NamePool.end(), pName, pName + strlen(pName) + 1);
+
+	this->NotifySubscribers(index);
+}
+
+void ScenarioVariableTable::Clear()
+{
+	this->Slots.clear();
+	this->SparseSlots.clear();
+	this->NamePool.clear();
+	this->Count = 0;
+
+	this->NotifyAllSubscribers();
+}
+
+void ScenarioVariableTable::Subscribe(int index, TEventClass* pEvent)
+{
+	auto& subscribers = this->Subscribers[index];
+
+	if (std::find(subscribers.begin(), subscribers.end(), pEvent) == subscribers.end())
+		subscribers.push_back(pEvent);
+}
+
+void ScenarioVariableTable::Unsubscribe(TEventClass* pEvent)
+{
+	for (auto it = this->Subscribers.begin(); it != this->Subscribers.end(); )
+	{
+		auto& subscribers = it->second;
+		subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), pEvent), subscribers.end());
+
+		if (subscribers.empty())
+			it = this->Subscribers.erase(it);
 		else
-			TagClass::NotifyGlobalChanged(nIndex);
+			++it;
 	}
 }
 
-void ScenarioExt::ExtData::GetVariableStateByID(bool bIsGlobal, int nIndex, char* pOut)
+void ScenarioVariableTable::NotifySubscribers(int index) const
+{
+	auto const it = this->Subscribers.find(index);
+
+	if (it == this->Subscribers.end())
+		return;
+
+	for (auto const pEvent : it->second)
+		TEventExt::MarkForEvaluation(pEvent);
+}
+
+void ScenarioVariableTable::NotifyAllSubscribers() const
+{
+	for (auto const& [index, subscribers] : this->Subscribers)
+	{
+		for (auto const pEvent : subscribers)
+			TEventExt::MarkForEvaluation(pEvent);
+	}
+}
+
+template <typename T>
+bool ScenarioVariableTable::Serialize(T& stm)
+{
+	return stm
+		.Process(this->Slots)
+		.Process(this->SparseSlots)
+		.Process(this->NamePool)
+		.Process(this->Count)
+		.Success();
+}
+
+bool ScenarioVariableTable::Load(PhobosStreamReader& stm, bool registerForChange)
+{
+	this->NotifyAllSubscribers();
+	return this->Serialize(stm);
+}
+
+bool ScenarioVariableTable::Save(PhobosStreamWriter& stm) const
+{
+	return const_cast<ScenarioVariableTable*>(this)->Serialize(stm);
+}
+
+CellStruct& ScenarioWaypointTable::FindOrInsert(int index)
+{
+	auto const it = std::lower_bound(this->Indices.begin(), this->Indices.end(), index);
+	auto const pos = it - this->Indices.begin();
+
+	if (it == this->Indices.end() || *it != index)
+	{
+		this->Indices.insert(it, index);
+		this->CellSlots.insert(this->CellSlots.begin() + pos, static_cast<int>(this->Cells.size()));
+		this->Cells.push_back(CellStruct::Empty);
+	}
+
+	return this->Cells[this->CellSlots[pos]];
+}
+
+// Used by the game's waypoint pointer getters, which insert unknown waypoints like the std::map they
+// replace did. Their callers only read through the pointer, and an inserted waypoint starts out empty,
+// so the defined list doesn't change.
+CellStruct& ScenarioWaypointTable::GetOrInsert(int index)
+{
+	return this->FindOrInsert(index);
+}
+
+void ScenarioWaypointTable::Set(int index, const CellStruct& cell)
+{
+	const bool wasDefined = this->IsDefined(index);
+	this->FindOrInsert(index) = cell;
+	const bool isDefined = this->IsDefined(index);
+
+	if (wasDefined != isDefined)
+	{
+		auto const itDefined = std::lower_bound(this->DefinedIndices.begin(), this->DefinedIndices.end(), index);
+
+		if (isDefined)
+			this->DefinedIndices.insert(itDefined, index);
+		else
+			this->DefinedIndices.erase(itDefined);
+	}
+}
+
+void ScenarioWaypointTable::Clear()
 {
-	auto& dict = Global()->Variables[bIsGlobal];
+	this->Indices.clear();
+	this->CellSlots.clear();
+	this->Cells.clear();
+	this->DefinedIndices.clear();
+}
+
+void ScenarioWaypointTable::RebuildDefinedIndices()
+{
+	this->DefinedIndices.clear();
 
-	auto itr = dict.find(nIndex);
-	if (itr != dict.end())
-		*pOut = static_cast<char>(itr->second.Value);
+	this->ForEach([this](int index, const CellStruct& cell)
+	{
+		if (index >= 0 && cell.X && cell.Y)
+			this->DefinedIndices.push_back(index);
+	});
+}
+
+// Saved as index / cell pairs in index order, the cell store is compacted on load.
+bool ScenarioWaypointTable::Load(PhobosStreamReader& stm, bool registerForChange)
+{
+	std::vector<int> indices;
+	std::vector<CellStruct> cells;
+	const bool success = stm
+		.Process(indices)
+		.Process(cells)
+		.Success();
+
+	this->Clear();
+
+	if (success && indices.size() == cells.size())
+	{
+		this->Indices = std::move(indices);
+		this->CellSlots.resize(this->Indices.size());
+
+		for (size_t i = 0; i < cells.size(); i++)
+		{
+			this->CellSlots[i] = static_cast<int>(i);
+			this->Cells.push_back(cells[i]);
+		}
+	}
+
+	this->RebuildDefinedIndices();
+	return success;
+}
+
+bool ScenarioWaypointTable::Save(PhobosStreamWriter& stm) const
+{
+	std::vector<CellStruct> cells;
+	cells.reserve(this->Indices.size());
+
+	for (auto const slot : this->CellSlots)
+		cells.push_back(this->Cells[slot]);
+
+	return stm
+		.Process(const_cast<ScenarioWaypointTable*>(this)->Indices)
+		.Process(cells)
+		.Success();
+}
+
+void ScenarioExt::ExtData::SetVariableToByID(bool bIsGlobal, int nIndex, char bState)
+{
+	auto const pValue = Global()->Variables[bIsGlobal].Find(nIndex);
+
+	if (pValue && *pValue != bState)
+	{
+		*pValue = bState;
+		ScenarioClass::Instance->VariablesChanged = true;
+		this->NotifyVariableChanged(bIsGlobal, nIndex);
+	}
+}
+
+// Notifies vanilla tags and Phobos trigger events reading the variable that its value has changed.
+void ScenarioExt::ExtData::NotifyVariableChanged(bool bIsGlobal, int nIndex)
+{
+	this->Variables[bIsGlobal].NotifySubscribers(nIndex);
+
+	if (!bIsGlobal)
+		TagClass::NotifyLocalChanged(nIndex);
+	else
+		TagClass::NotifyGlobalChanged(nIndex);
+}
+
+void ScenarioExt::ExtData::GetVariableStateByID(bool bIsGlobal, int nIndex, char* pOut)
+{
+	if (auto const pValue = Global()->Variables[bIsGlobal].Find(nIndex))
+		*pOut = static_cast<char>(*pValue);
 }
 
 void ScenarioExt::ExtData::ReadVariables(bool bIsGlobal, CCINIClass* pINI)
 {
 	if (!bIsGlobal) // Local variables need to be read again
-		Global()->Variables[false].clear();
-	else if (Global()->Variables[true].size() != 0) // Global variables had been loaded, DO NOT CHANGE THEM
+		Global()->Variables[false].Clear();
+	else if (!Global()->Variables[true].Empty()) // Global variables had been loaded, DO NOT CHANGE THEM
 		return;
 
 	int nCount = pINI->GetKeyCount("VariableNames");
@@ -47,14 +256,11 @@ void ScenarioExt::ExtData::ReadVariables(bool bIsGlobal, CCINIClass* pINI)
 		int nIndex;
 		if (sscanf_s(pKey, "%d", &nIndex) == 1)
 		{
-			auto& var = Global()->Variables[bIsGlobal][nIndex];
 			pINI->ReadString("VariableNames", pKey, pKey, Phobos::readBuffer);
 			char* buffer;
-			strcpy_s(var.Name, strtok_s(Phobos::readBuffer, ",", &buffer));
-			if (auto pState = strtok_s(nullptr, ",", &buffer))
-				var.Value = atoi(pState);
-			else
-				var.Value = 0;
+			auto const pName = strtok_s(Phobos::readBuffer, ",", &buffer);
+			auto const pState = strtok_s(nullptr, ",", &buffer);
+			Global()->Variables[bIsGlobal].Define(nIndex, pName ? pName : "", pState ? atoi(pState) : 0);
 		}
 	}
 }
@@ -70,8 +276,10 @@ void ScenarioExt::ExtData::SaveVariablesToFile(bool isGlobal)
 	else
 		file.CreateFileA();
 
-	for (const auto& [_,varext] : Global()->Variables[isGlobal])
-		fINI.WriteInteger(ScenarioClass::Instance->FileName, varext.Name, varext.Value, false);
+	Global()->Variables[isGlobal].ForEach([&fINI](int, const char* pName, int& value)
+		{
+			fINI.WriteInteger(ScenarioClass::Instance->FileName, pName, value, false);
+		});
 
 	fINI.WriteCCFile(&file);
 	file.Close();
@@ -186,9 +394,9 @@ DEFINE_HOOK(0x683549, ScenarioClass_CTOR, 0x9)
 
 	ScenarioExt::Allocate(pItem);
 
-	ScenarioExt::Global()->Waypoints.clear();
-	ScenarioExt::Global()->Variables[0].clear();
-	ScenarioExt::Global()->Variables[1].clear();
+	ScenarioExt::Global()->Waypoints.Clear();
+	ScenarioExt::Global()->Variables[0].Clear();
+	ScenarioExt::Global()->Variables[1].Clear();
 
 	return 0;
 }
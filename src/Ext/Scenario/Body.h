@@ -9,11 +9,166 @@
 #include <Ext/Techno/Body.h>
 
 #include <map>
+#include <deque>
+#include <algorithm>
 
-struct ExtendedVariable
+class TEventClass;
+
+// Dense variable storage addressed directly by variable index, names are kept in a separate pool.
+// Negative indices and ones from DenseIndexLimit up are rare and kept in a sparse map instead.
+// Trigger events comparing variables subscribe to the indices they read and are notified on change.
+class ScenarioVariableTable
 {
-	char Name[0x100];
-	int Value;
+public:
+	static constexpr int DenseIndexLimit = 0x1000;
+
+	ScenarioVariableTable() : Slots {}, SparseSlots {}, NamePool {}, Subscribers {}, Count { 0 }
+	{ }
+
+	int* Find(int index)
+	{
+		auto const pSlot = this->FindSlot(index);
+		return pSlot ? &pSlot->Value : nullptr;
+	}
+
+	const int* Find(int index) const
+	{
+		auto const pSlot = const_cast<ScenarioVariableTable*>(this)->FindSlot(index);
+		return pSlot ? &pSlot->Value : nullptr;
+	}
+
+	const char* GetName(int index) const
+	{
+		auto const pSlot = const_cast<ScenarioVariableTable*>(this)->FindSlot(index);
+		return pSlot ? &this->NamePool[pSlot->NameOffset] : nullptr;
+	}
+
+	bool Empty() const
+	{
+		return !this->Count;
+	}
+
+	void Define(int index, const char* pName, int value);
+	void Clear();
+
+	void Subscribe(int index, TEventClass* pEvent);
+	void Unsubscribe(TEventClass* pEvent);
+	void NotifySubscribers(int index) const;
+
+	// func(int index, const char* pName, int& value), called in ascending index order.
+	template <typename Func>
+	void ForEach(Func&& func)
+	{
+		auto itSparse = this->SparseSlots.begin();
+
+		for (; itSparse != this->SparseSlots.end() && itSparse->first < 0; ++itSparse)
+			func(itSparse->first, &this->NamePool[itSparse->second.NameOffset], itSparse->second.Value);
+
+		for (size_t i = 0; i < this->Slots.size(); i++)
+		{
+			auto& slot = this->Slots[i];
+
+			if (slot.NameOffset >= 0)
+				func(static_cast<int>(i), &this->NamePool[slot.NameOffset], slot.Value);
+		}
+
+		for (; itSparse != this->SparseSlots.end(); ++itSparse)
+			func(itSparse->first, &this->NamePool[itSparse->second.NameOffset], itSparse->second.Value);
+	}
+
+	bool Load(PhobosStreamReader& stm, bool registerForChange);
+	bool Save(PhobosStreamWriter& stm) const;
+
+private:
+	struct Slot
+	{
+		int Value;
+		int NameOffset; // Offset into NamePool, -1 if the variable is not defined.
+	};
+
+	static bool IsDenseIndex(int index)
+	{
+		return index >= 0 && index < ScenarioVariableTable::DenseIndexLimit;
+	}
+
+	Slot* FindSlot(int index)
+	{
+		if (IsDenseIndex(index))
+			return static_cast<size_t>(index) < this->Slots.size() && this->Slots[index].NameOffset >= 0 ? &this->Slots[index] : nullptr;
+
+		auto const it = this->SparseSlots.find(index);
+		return it != this->SparseSlots.end() ? &it->second : nullptr;
+	}
+
+	void NotifyAllSubscribers() const;
+
+	template <typename T>
+	bool Serialize(T& stm);
+
+	std::vector<Slot> Slots;
+	std::map<int, Slot> SparseSlots;
+	std::vector<char> NamePool;
+	std::map<int, std::vector<TEventClass*>> Subscribers; // Rebuilt as events are evaluated, not saved.
+	int Count;
+};
+
+// Waypoint storage with a sorted index list pointing into a separate cell store, plus a sorted list of
+// the defined ones (non-zero cell) so random waypoint selection doesn't need to filter the whole table.
+// Cells are only ever appended to a deque so pointers handed to the game stay valid until Clear(),
+// the same as with the std::map this replaces.
+class ScenarioWaypointTable
+{
+public:
+	ScenarioWaypointTable() : Indices {}, CellSlots {}, Cells {}, DefinedIndices {}
+	{ }
+
+	const CellStruct* Find(int index) const
+	{
+		auto const it = std::lower_bound(this->Indices.begin(), this->Indices.end(), index);
+		return it != this->Indices.end() && *it == index ? &this->Cells[this->CellSlots[it - this->Indices.begin()]] : nullptr;
+	}
+
+	// Returns an empty cell for unknown waypoints.
+	CellStruct Get(int index) const
+	{
+		auto const pCell = this->Find(index);
+		return pCell ? *pCell : CellStruct::Empty;
+	}
+
+	bool IsDefined(int index) const
+	{
+		auto const pCell = this->Find(index);
+		return index >= 0 && pCell && pCell->X && pCell->Y;
+	}
+
+	const std::vector<int>& GetDefinedIndices() const
+	{
+		return this->DefinedIndices;
+	}
+
+	CellStruct& GetOrInsert(int index);
+	void Set(int index, const CellStruct& cell);
+	void Clear();
+
+	// func(int index, const CellStruct& cell)
+	template <typename Func>
+	void ForEach(Func&& func) const
+	{
+		for (size_t i = 0; i < this->Indices.size(); i++)
+			func(this->Indices[i], this->Cells[this->CellSlots[i]]);
+	}
+
+	bool Load(PhobosStreamReader& stm, bool registerForChange);
+	bool Save(PhobosStreamWriter& stm) const;
+
+private:
+	CellStruct& FindOrInsert(int index);
+	void RebuildDefinedIndices();
+
+	std::vector<int> Indices;
+	std::vector<int> CellSlots; // Position in Cells for each entry of Indices.
+	std::deque<CellStruct> Cells;
+	std::vector<int> DefinedIndices; // Kept up to date by Set() and Clear(), rebuilt on load.
 };
 
 class ScenarioExt
@@ -30,8 +185,8 @@ public:
 		bool ShowBriefing;
 		int BriefingTheme;
 
-		std::map<int, CellStruct> Waypoints;
-		std::map<int, ExtendedVariable> Variables[2]; // 0 for local, 1 for global
+		ScenarioWaypointTable Waypoints;
+		ScenarioVariableTable Variables[2]; // 0 for local, 1 for global
 
 		std::vector<TechnoExt::ExtData*> AutoDeathObjects;
 		std::vector<TechnoExt::ExtData*> TransportReloaders; // Objects that can reload ammo in limbo
@@ -46,6 +201,7 @@ public:
 		{ }
 
 		void SetVariableToByID(bool bIsGlobal, int nIndex, char bState);
+		void NotifyVariableChanged(bool bIsGlobal, int nIndex);
 		void GetVariableStateByID(bool bIsGlobal, int nIndex, char* pOut);
 		void ReadVariables(bool bIsGlobal, CCINIClass* pINI);
 		static void SaveVariablesToFile(bool isGlobal);
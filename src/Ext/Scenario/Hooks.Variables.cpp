@@ -65,15 +65,18 @@ DEFINE_HOOK(0x689880, ScenarioClass_ReadGlobalVariables, 0x6)
 
 DEFINE_HOOK(0x685354, ClearLotsOfShit_GlobalVariable, 0x9)
 {
-	for (auto& [idx, var] : ScenarioExt::Global()->Variables[1])
-	{
-		if (var.Value)
+	auto const pScenarioExt = ScenarioExt::Global();
+
+	pScenarioExt->Variables[1].ForEach([pScenarioExt](int idx, const char*, int& value)
 		{
-			var.Value = 0;
-			ScenarioClass::Instance->VariablesChanged = true;
-			TagClass::NotifyGlobalChanged(idx);
-		}
-	}
+			if (value)
+			{
+				value = 0;
+				ScenarioClass::Instance->VariablesChanged = true;
+				pScenarioExt->NotifyVariableChanged(true, idx);
+			}
+		});
+
 	return 0x68538D;
 }
 
@@ -89,8 +92,11 @@ DEFINE_HOOK(0x4C6217, EvadeClass_DoShit_Globals, 0x0)
 DEFINE_HOOK(0x4C6185, EvadeClass_CarryOverShit_Globals, 0x0)
 {
 	CarryOverGlobalsBuffer.clear();
-	for (auto const& [idx, var] : ScenarioExt::Global()->Variables[1])
-		CarryOverGlobalsBuffer.emplace_back(idx, var.Value);
+	ScenarioExt::Global()->Variables[1].ForEach([](int idx, const char*, int& value)
+		{
+			CarryOverGlobalsBuffer.emplace_back(idx, value);
+		});
+
 	return 0x4C61A3;
 }
 
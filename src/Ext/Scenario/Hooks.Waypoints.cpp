@@ -9,7 +9,7 @@ DEFINE_HOOK(0x68BCC0, ScenarioClass_Get_Waypoint_Location, 0xB)
 	GET_STACK(CellStruct*, pCell, 0x4);
 	GET_STACK(int, nWaypoint, 0x8);
 
-	*pCell = ScenarioExt::Global()->Waypoints[nWaypoint];
+	*pCell = ScenarioExt::Global()->Waypoints.Get(nWaypoint);
 
 	R->EAX(pCell);
 
@@ -20,7 +20,7 @@ DEFINE_HOOK(0x68BCE4, ScenarioClass_Get_Waypoint_Cell_0, 0x7)
 {
 	GET_STACK(int, nWaypoint, 0x4);
 
-	R->ECX(&ScenarioExt::Global()->Waypoints[nWaypoint]);
+	R->ECX(&ScenarioExt::Global()->Waypoints.GetOrInsert(nWaypoint));
 
 	return 0x68BCEB;
 }
@@ -29,14 +29,14 @@ DEFINE_HOOK(0x68BD08, ScenarioClass_Get_Waypoint, 0x7)
 {
 	GET_STACK(int, nWaypoint, STACK_OFFSET(0x10, 0x8));
 
-	R->ECX(&ScenarioExt::Global()->Waypoints[nWaypoint]);
+	R->ECX(&ScenarioExt::Global()->Waypoints.GetOrInsert(nWaypoint));
 
 	return 0x68BD0F;
 }
 
 DEFINE_HOOK(0x68BD60, ScenarioClass_Clear_All_Waypoints, 0x6)
 {
-	ScenarioExt::Global()->Waypoints.clear();
+	ScenarioExt::Global()->Waypoints.Clear();
 
 	return 0x68BD79;
 }
@@ -44,9 +44,8 @@ DEFINE_HOOK(0x68BD60, ScenarioClass_Clear_All_Waypoints, 0x6)
 DEFINE_HOOK(0x68BD80, ScenarioClass_Is_Waypoint_Valid, 0x5)
 {
 	GET_STACK(int, nWaypoint, 0x4);
-	auto& waypoints = ScenarioExt::Global()->Waypoints;
 
-	R->AL(nWaypoint >= 0 && waypoints.find(nWaypoint) != waypoints.end() && waypoints[nWaypoint].X && waypoints[nWaypoint].Y);
+	R->AL(ScenarioExt::Global()->Waypoints.IsDefined(nWaypoint));
 
 	return 0x68BDB3;
 }
@@ -73,7 +72,7 @@ DEFINE_HOOK(0x68BDC0, ScenarioClass_ReadWaypoints, 0x8)
 				pCell->Flags |= CellFlags::IsWaypoint;
 			else if (ScenarioExt::CellParsed)
 				Debug::Log("[Developer warning] Can not get waypoint %d : [%d, %d]!\n", id, buffer.X, buffer.Y);
-			ScenarioExt::Global()->Waypoints[id] = buffer;
+			ScenarioExt::Global()->Waypoints.Set(id, buffer);
 		}
 		else
 			Debug::Log("[Developer warning] Invalid waypoint %d!\n", id);
@@ -94,12 +93,12 @@ DEFINE_HOOK(0x68BE90, ScenarioClass_Write_Waypoints, 0x5)
 
 	pINI->Clear("Waypoints", nullptr);
 
-	for (const auto& pair : ScenarioExt::Global()->Waypoints)
+	ScenarioExt::Global()->Waypoints.ForEach([pINI](int index, const CellStruct& cell)
 	{
 		char buffer[32];
-		sprintf_s(buffer, "%d", pair.first);
-		pINI->WriteInteger("Waypoints", buffer, pair.second.X + 1000 * pair.second.Y, false);
-	}
+		sprintf_s(buffer, "%d", index);
+		pINI->WriteInteger("Waypoints", buffer, cell.X + 1000 * cell.Y, false);
+	});
 
 	return 0x68BF1F;
 }
@@ -115,7 +114,7 @@ DEFINE_HOOK(0x68BF50, ScenarioClass_Set_Waypoint, 0x8)
 	GET_STACK(int, nWaypoint, 0x4);
 	GET_STACK(CellStruct, cell, 0x8);
 
-	ScenarioExt::Global()->Waypoints[nWaypoint] = cell;
+	ScenarioExt::Global()->Waypoints.Set(nWaypoint, cell);
 
 	return 0x68BF5F;
 }
@@ -124,7 +123,7 @@ DEFINE_HOOK(0x68BF74, ScenarioClass_Get_Waypoint_Cell, 0x7)
 {
 	GET_STACK(int, nWaypoint, 0x4);
 
-	R->ECX(&ScenarioExt::Global()->Waypoints[nWaypoint]);
+	R->ECX(&ScenarioExt::Global()->Waypoints.GetOrInsert(nWaypoint));
 
 	return 0x68BF7B;
 }
@@ -205,7 +204,7 @@ DEFINE_HOOK(0x68843B, ScenStruct_ScenStruct_2, 0x6)
 
 	if (ScenarioClass::Instance->IsDefinedWaypoint(i))
 	{
-		waypoints.AddItem(ScenarioExt::Global()->Waypoints[i]);
+		waypoints.AddItem(ScenarioExt::Global()->Waypoints.Get(i));
 		Debug::Log("Multiplayer start waypoint found at cell %d,%d\n", buffer.X, buffer.Y);
 	}
 	return 0x6884EF;
@@ -226,7 +225,7 @@ DEFINE_HOOK(0x684CB7, Scen_Waypoint_Call_1, 0x7)
 {
 	GET(int, nWaypoint, EAX);
 
-	CellStruct cell = ScenarioExt::Global()->Waypoints[nWaypoint];
+	CellStruct cell = ScenarioExt::Global()->Waypoints.Get(nWaypoint);
 
 	R->EAX(*(int*)&cell);
 	return 0x684CBE;
@@ -234,7 +233,7 @@ DEFINE_HOOK(0x684CB7, Scen_Waypoint_Call_1, 0x7)
 
 DEFINE_HOOK(0x6855E4, Scen_Waypoint_Call_2, 0x5)
 {
-	ScenarioExt::Global()->Waypoints.clear();
+	ScenarioExt::Global()->Waypoints.Clear();
 
 	return 0x6855FC;
 }
@@ -243,7 +242,7 @@ DEFINE_HOOK(0x68AFE7, Scen_Waypoint_Call_3, 0x5)
 {
 	GET(int, nWaypoint, EDI);
 
-	CellStruct cell = ScenarioExt::Global()->Waypoints[nWaypoint];
+	CellStruct cell = ScenarioExt::Global()->Waypoints.Get(nWaypoint);
 
 	R->EDX(*(int*)&cell);
 	return 0x68AFEE;
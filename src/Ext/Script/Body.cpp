@@ -3,8 +3,12 @@
 #include <Ext/House/Body.h>
 #include <Ext/Techno/Body.h>
 #include <Ext/Scenario/Body.h>
+#include <Utilities/Profiler.h>
 
 ScriptExt::ExtContainer ScriptExt::ExtMap;
+std::unordered_map<TeamTypeClass*, AITriggerTypeClass*> ScriptExt::TeamTriggerIndex;
+int ScriptExt::TeamTriggerIndexCount = -1;
+std::unordered_map<ScriptTypeClass*, std::vector<ScriptExt::ScriptLine>> ScriptExt::CompiledScripts;
 
 // =============================
 // load / save
@@ -27,207 +31,291 @@ ScriptExt::ExtContainer::ExtContainer() : Container("ScriptClass")
 
 ScriptExt::ExtContainer::~ExtContainer() = default;
 
+DEFINE_PROFILE_SECTION(Profile_ScriptProcessAction, "ScriptExt::ProcessAction");
+
+#ifndef IS_RELEASE_VER
+// Per-action sections are only created while the profiler runs, one for each action number seen.
+static ProfileSection& ScriptExt_GetActionProfileSection(int action)
+{
+	struct ActionSection
+	{
+		std::string Name;
+		ProfileSection Section;
+
+		ActionSection(int action) : Name { "ScriptAction_" + std::to_string(action) }, Section { Name.c_str() }
+		{ }
+	};
+
+	static std::unordered_map<int, std::unique_ptr<ActionSection>> sections;
+	auto& pSection = sections[action];
+
+	if (!pSection)
+		pSection = std::make_unique<ActionSection>(action);
+
+	return pSection->Section;
+}
+#endif
+
 void ScriptExt::ProcessAction(TeamClass* pTeam)
 {
-	const int action = pTeam->CurrentScript->Type->ScriptActions[pTeam->CurrentScript->CurrentMission].Action;
-	const int argument = pTeam->CurrentScript->Type->ScriptActions[pTeam->CurrentScript->CurrentMission].Argument;
+	PROFILE_SCOPE(Profile_ScriptProcessAction);
+
+	auto const pScript = pTeam->CurrentScript;
+	auto const& lines = ScriptExt::GetCompiledScript(pScript->Type);
+
+	if (static_cast<size_t>(pScript->CurrentMission) >= lines.size())
+		return;
+
+	auto const& line = lines[pScript->CurrentMission];
+
+	if (!line.Execute)
+		return;
+
+#ifndef IS_RELEASE_VER
+	if (Profiler::Enabled)
+	{
+		Profiler::ScopedTimer timer { ScriptExt_GetActionProfileSection(line.Action) };
+		line.Execute(pTeam, line);
+		return;
+	}
+#endif
+
+	line.Execute(pTeam, line);
+}
+
+const std::vector<ScriptExt::ScriptLine>& ScriptExt::GetCompiledScript(ScriptTypeClass* pType)
+{
+	auto const [it, inserted] = CompiledScripts.try_emplace(pType);
+
+	if (inserted)
+		ScriptExt::CompileScript(pType, it->second);
+
+	return it->second;
+}
+
+void ScriptExt::CompileScript(ScriptTypeClass* pType, std::vector<ScriptLine>& lines)
+{
+	auto const pRulesExt = RulesExt::Global();
+	auto const& targetTypesLists = pRulesExt->AITargetTypesLists;
+	auto const& scriptsLists = pRulesExt->AIScriptsLists;
+
+	lines.resize(static_cast<size_t>(std::max(pType->ActionsCount, 0)));
+
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		auto const& node = pType->ScriptActions[i];
+		auto& line = lines[i];
+		auto const listIndex = static_cast<size_t>(node.Argument); // negative arguments end up out of range
+
+		line.Action = node.Action;
+		line.Argument = node.Argument;
+		line.LoArgument = LOWORD(node.Argument);
+		line.HiArgument = HIWORD(node.Argument);
+		line.TargetTypes = listIndex < targetTypesLists.size() ? &targetTypesLists[listIndex] : nullptr;
+		line.Scripts = listIndex < scriptsLists.size() ? &scriptsLists[listIndex] : nullptr;
+		line.Execute = ScriptExt::GetLineHandler(line);
+	}
+}
+
+static bool ScriptExt_UsesTargetTypesList(PhobosScripts action)
+{
+	switch (action)
+	{
+	case PhobosScripts::RepeatAttackTypeCloserThreat:
+	case PhobosScripts::RepeatAttackTypeFartherThreat:
+	case PhobosScripts::RepeatAttackTypeCloser:
+	case PhobosScripts::RepeatAttackTypeFarther:
+	case PhobosScripts::SingleAttackTypeCloserThreat:
+	case PhobosScripts::SingleAttackTypeFartherThreat:
+	case PhobosScripts::SingleAttackTypeCloser:
+	case PhobosScripts::SingleAttackTypeFarther:
+	case PhobosScripts::MoveToTypeEnemyCloser:
+	case PhobosScripts::MoveToTypeEnemyFarther:
+	case PhobosScripts::MoveToTypeFriendlyCloser:
+	case PhobosScripts::MoveToTypeFriendlyFarther:
+	case PhobosScripts::RandomAttackTypeCloser:
+	case PhobosScripts::RandomAttackTypeFarther:
+	case PhobosScripts::RandomMoveToTypeEnemyCloser:
+	case PhobosScripts::RandomMoveToTypeEnemyFarther:
+	case PhobosScripts::RandomMoveToTypeFriendlyCloser:
+	case PhobosScripts::RandomMoveToTypeFriendlyFarther:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void ScriptExt_MissingListAction(TeamClass* pTeam, const ScriptExt::ScriptLine& line)
+{
+	auto const pScript = pTeam->CurrentScript;
+
+	// This action finished
+	pTeam->StepCompleted = true;
+	ScriptExt::Log("AI Scripts - ProcessAction: [%s] [%s] (line %d = %d,%d): List index %d doesn't exist!\n", pTeam->Type->ID, pScript->Type->ID, pScript->CurrentMission, line.Action, line.Argument, line.Argument);
+}
+
+static void ScriptExt_UnknownAction(TeamClass* pTeam, const ScriptExt::ScriptLine& line)
+{
+	// Unknown new action. This action finished
+	pTeam->StepCompleted = true;
+	ScriptExt::Log("AI Scripts - ProcessAction: [%s] [%s] (line %d): Unknown Script Action: %d\n", pTeam->Type->ID, pTeam->CurrentScript->Type->ID, pTeam->CurrentScript->CurrentMission, line.Action);
+}
 
-	switch (static_cast<PhobosScripts>(action))
+// Arguments are taken from the decoded line, the handlers only read the script node themselves when given a negative value
+ScriptExt::ScriptLine::Handler ScriptExt::GetLineHandler(const ScriptLine& compiled)
+{
+	auto const action = static_cast<PhobosScripts>(compiled.Action);
+
+	if (ScriptExt_UsesTargetTypesList(action) && !compiled.TargetTypes)
+		return &ScriptExt_MissingListAction;
+
+	switch (action)
 	{
 	case PhobosScripts::TimedAreaGuard:
-		ScriptExt::ExecuteTimedAreaGuardAction(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::ExecuteTimedAreaGuardAction(pTeam); };
 	case PhobosScripts::LoadIntoTransports:
-		ScriptExt::LoadIntoTransports(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::LoadIntoTransports(pTeam); };
 	case PhobosScripts::WaitUntilFullAmmo:
-		ScriptExt::WaitUntilFullAmmoAction(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::WaitUntilFullAmmoAction(pTeam); };
 	case PhobosScripts::RepeatAttackCloserThreat:
 		// Threats that are close have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack(pTeam, true, 0, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, true, 0, -1, -1); };
 	case PhobosScripts::RepeatAttackFartherThreat:
 		// Threats that are far have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack(pTeam, true, 1, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, true, 1, -1, -1); };
 	case PhobosScripts::RepeatAttackCloser:
 		// Closer targets from Team Leader have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack(pTeam, true, 2, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, true, 2, -1, -1); };
 	case PhobosScripts::RepeatAttackFarther:
 		// Farther targets from Team Leader have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack(pTeam, true, 3, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, true, 3, -1, -1); };
 	case PhobosScripts::SingleAttackCloserThreat:
 		// Threats that are close have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack(pTeam, false, 0, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, false, 0, -1, -1); };
 	case PhobosScripts::SingleAttackFartherThreat:
 		// Threats that are far have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack(pTeam, false, 1, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, false, 1, -1, -1); };
 	case PhobosScripts::SingleAttackCloser:
 		// Closer targets from Team Leader have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack(pTeam, false, 2, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, false, 2, -1, -1); };
 	case PhobosScripts::SingleAttackFarther:
 		// Farther targets from Team Leader have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack(pTeam, false, 3, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Attack(pTeam, false, 3, -1, -1); };
 	case PhobosScripts::DecreaseCurrentAITriggerWeight:
-		ScriptExt::DecreaseCurrentTriggerWeight(pTeam, true, 0);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::DecreaseCurrentTriggerWeight(pTeam, true, line.Argument); };
 	case PhobosScripts::IncreaseCurrentAITriggerWeight:
-		ScriptExt::IncreaseCurrentTriggerWeight(pTeam, true, 0);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::IncreaseCurrentTriggerWeight(pTeam, true, line.Argument); };
 	case PhobosScripts::RepeatAttackTypeCloserThreat:
 		// Threats specific targets that are close have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack_List(pTeam, true, 0, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, true, 0, line.Argument); };
 	case PhobosScripts::RepeatAttackTypeFartherThreat:
 		// Threats specific targets that are far have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack_List(pTeam, true, 1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, true, 1, line.Argument); };
 	case PhobosScripts::RepeatAttackTypeCloser:
 		// Closer specific targets targets from Team Leader have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack_List(pTeam, true, 2, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, true, 2, line.Argument); };
 	case PhobosScripts::RepeatAttackTypeFarther:
 		// Farther specific targets targets from Team Leader have more priority. Kill until no more targets.
-		ScriptExt::Mission_Attack_List(pTeam, true, 3, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, true, 3, line.Argument); };
 	case PhobosScripts::SingleAttackTypeCloserThreat:
 		// Threats specific targets that are close have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack_List(pTeam, false, 0, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, false, 0, line.Argument); };
 	case PhobosScripts::SingleAttackTypeFartherThreat:
 		// Threats specific targets that are far have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack_List(pTeam, false, 1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, false, 1, line.Argument); };
 	case PhobosScripts::SingleAttackTypeCloser:
 		// Closer specific targets from Team Leader have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack_List(pTeam, false, 2, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, false, 2, line.Argument); };
 	case PhobosScripts::SingleAttackTypeFarther:
 		// Farther specific targets from Team Leader have more priority. 1 kill only (good for xx=49,0 combos)
-		ScriptExt::Mission_Attack_List(pTeam, false, 3, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List(pTeam, false, 3, line.Argument); };
 	case PhobosScripts::WaitIfNoTarget:
-		ScriptExt::WaitIfNoTarget(pTeam, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::WaitIfNoTarget(pTeam, line.Argument); };
 	case PhobosScripts::TeamWeightReward:
-		ScriptExt::TeamWeightReward(pTeam, 0);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::TeamWeightReward(pTeam, line.Argument); };
 	case PhobosScripts::PickRandomScript:
-		ScriptExt::PickRandomScript(pTeam, -1);
-		break;
+		if (!compiled.Scripts)
+			return &ScriptExt_MissingListAction;
+
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::PickRandomScript(pTeam, line.Argument); };
 	case PhobosScripts::MoveToEnemyCloser:
 		// Move to the closest enemy target
-		ScriptExt::Mission_Move(pTeam, 2, false, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Move(pTeam, 2, false, -1, -1); };
 	case PhobosScripts::MoveToEnemyFarther:
 		// Move to the farther enemy target
-		ScriptExt::Mission_Move(pTeam, 3, false, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Move(pTeam, 3, false, -1, -1); };
 	case PhobosScripts::MoveToFriendlyCloser:
 		// Move to the closest friendly target
-		ScriptExt::Mission_Move(pTeam, 2, true, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Move(pTeam, 2, true, -1, -1); };
 	case PhobosScripts::MoveToFriendlyFarther:
 		// Move to the farther friendly target
-		ScriptExt::Mission_Move(pTeam, 3, true, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Move(pTeam, 3, true, -1, -1); };
 	case PhobosScripts::MoveToTypeEnemyCloser:
 		// Move to the closest specific enemy target
-		ScriptExt::Mission_Move_List(pTeam, 2, false, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List(pTeam, 2, false, line.Argument); };
 	case PhobosScripts::MoveToTypeEnemyFarther:
 		// Move to the farther specific enemy target
-		ScriptExt::Mission_Move_List(pTeam, 3, false, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List(pTeam, 3, false, line.Argument); };
 	case PhobosScripts::MoveToTypeFriendlyCloser:
 		// Move to the closest specific friendly target
-		ScriptExt::Mission_Move_List(pTeam, 2, true, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List(pTeam, 2, true, line.Argument); };
 	case PhobosScripts::MoveToTypeFriendlyFarther:
 		// Move to the farther specific friendly target
-		ScriptExt::Mission_Move_List(pTeam, 3, true, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List(pTeam, 3, true, line.Argument); };
 	case PhobosScripts::ModifyTargetDistance:
 		// AISafeDistance equivalent for Mission_Move()
-		ScriptExt::SetCloseEnoughDistance(pTeam, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::SetCloseEnoughDistance(pTeam, line.Argument); };
 	case PhobosScripts::RandomAttackTypeCloser:
 		// Pick 1 closer random objective from specific list for attacking it
-		ScriptExt::Mission_Attack_List1Random(pTeam, true, 2, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List1Random(pTeam, true, 2, line.Argument); };
 	case PhobosScripts::RandomAttackTypeFarther:
 		// Pick 1 farther random objective from specific list for attacking it
-		ScriptExt::Mission_Attack_List1Random(pTeam, true, 3, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Attack_List1Random(pTeam, true, 3, line.Argument); };
 	case PhobosScripts::RandomMoveToTypeEnemyCloser:
 		// Pick 1 closer enemy random objective from specific list for moving to it
-		ScriptExt::Mission_Move_List1Random(pTeam, 2, false, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List1Random(pTeam, 2, false, line.Argument, -1); };
 	case PhobosScripts::RandomMoveToTypeEnemyFarther:
 		// Pick 1 farther enemy random objective from specific list for moving to it
-		ScriptExt::Mission_Move_List1Random(pTeam, 3, false, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List1Random(pTeam, 3, false, line.Argument, -1); };
 	case PhobosScripts::RandomMoveToTypeFriendlyCloser:
 		// Pick 1 closer friendly random objective from specific list for moving to it
-		ScriptExt::Mission_Move_List1Random(pTeam, 2, true, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List1Random(pTeam, 2, true, line.Argument, -1); };
 	case PhobosScripts::RandomMoveToTypeFriendlyFarther:
 		// Pick 1 farther friendly random objective from specific list for moving to it
-		ScriptExt::Mission_Move_List1Random(pTeam, 3, true, -1, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Mission_Move_List1Random(pTeam, 3, true, line.Argument, -1); };
 	case PhobosScripts::SetMoveMissionEndMode:
 		// Set the condition for ending the Mission_Move Actions.
-		ScriptExt::SetMoveMissionEndMode(pTeam, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::SetMoveMissionEndMode(pTeam, line.Argument); };
 	case PhobosScripts::UnregisterGreatSuccess:
 		// Un-register success for AITrigger weight adjustment (this is the opposite of 49,0)
-		ScriptExt::UnregisterGreatSuccess(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::UnregisterGreatSuccess(pTeam); };
 	case PhobosScripts::GatherAroundLeader:
-		ScriptExt::Mission_Gather_NearTheLeader(pTeam, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Mission_Gather_NearTheLeader(pTeam, -1); };
 	case PhobosScripts::RandomSkipNextAction:
-		ScriptExt::SkipNextAction(pTeam, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::SkipNextAction(pTeam, line.Argument); };
 	case PhobosScripts::StopForceJumpCountdown:
 		// Stop Timed Jump
-		ScriptExt::Stop_ForceJump_Countdown(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::Stop_ForceJump_Countdown(pTeam); };
 	case PhobosScripts::NextLineForceJumpCountdown:
 		// Start Timed Jump that jumps to the next line when the countdown finish (in frames)
-		ScriptExt::Set_ForceJump_Countdown(pTeam, false, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Set_ForceJump_Countdown(pTeam, false, 15 * line.Argument); };
 	case PhobosScripts::SameLineForceJumpCountdown:
 		// Start Timed Jump that jumps to the same line when the countdown finish (in frames)
-		ScriptExt::Set_ForceJump_Countdown(pTeam, true, -1);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::Set_ForceJump_Countdown(pTeam, true, 15 * line.Argument); };
 	case PhobosScripts::JumpBackToPreviousScript:
-		ScriptExt::JumpBackToPreviousScript(pTeam);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine&) { ScriptExt::JumpBackToPreviousScript(pTeam); };
 	case PhobosScripts::ChronoshiftToEnemyBase:
 		// Chronoshift to enemy base, argument is additional distance modifier
-		ScriptExt::ChronoshiftToEnemyBase(pTeam, argument);
-		break;
+		return [](TeamClass* pTeam, const ScriptLine& line) { ScriptExt::ChronoshiftToEnemyBase(pTeam, line.Argument); };
 	default:
 		// Do nothing because or it is a wrong Action number or it is an Ares/YR action...
-		if (action > 70 && !IsExtVariableAction(action))
-		{
-			// Unknown new action. This action finished
-			pTeam->StepCompleted = true;
-			ScriptExt::Log("AI Scripts - ProcessAction: [%s] [%s] (line %d): Unknown Script Action: %d\n", pTeam->Type->ID, pTeam->CurrentScript->Type->ID, pTeam->CurrentScript->CurrentMission, pTeam->CurrentScript->Type->ScriptActions[pTeam->CurrentScript->CurrentMission].Action);
-		}
-		break;
-	}
+		if (IsExtVariableAction(compiled.Action))
+			return ScriptExt::GetVariableHandler(action);
+		else if (compiled.Action > 70)
+			return &ScriptExt_UnknownAction;
 
-	if (IsExtVariableAction(action))
-		VariablesHandler(pTeam, static_cast<PhobosScripts>(action), argument);
+		return nullptr;
+	}
 }
 
 void ScriptExt::ExecuteTimedAreaGuardAction(TeamClass* pTeam)
@@ -330,31 +418,22 @@ void ScriptExt::LoadIntoTransports(TeamClass* pTeam)
 
 void ScriptExt::WaitUntilFullAmmoAction(TeamClass* pTeam)
 {
-	for (auto pUnit = pTeam->FirstUnit; pUnit; pUnit = pUnit->NextTeamMember)
+	auto const pExt = TeamExt::ExtMap.Find(pTeam);
+
+	if (auto const pUnit = pExt ? pExt->GetMemberSummary().FirstUnitReloading : nullptr)
 	{
-		if (!pUnit->InLimbo && pUnit->Health > 0)
+		// If an aircraft object have AirportBound it must be evaluated
+		if (pUnit->WhatAmI() == AbstractType::Aircraft)
 		{
-			if (pUnit->GetTechnoType()->Ammo > 0 && pUnit->Ammo < pUnit->GetTechnoType()->Ammo)
-			{
-				// If an aircraft object have AirportBound it must be evaluated
-				if (auto const pAircraft = abstract_cast<AircraftClass*>(pUnit))
-				{
-					if (pAircraft->Type->AirportBound)
-					{
-						// Reset last target, at long term battles this prevented the aircraft to pick a new target (rare vanilla YR bug)
-						pUnit->SetTarget(nullptr);
-						pUnit->LastTarget = nullptr;
-						// Fix YR bug (when returns from the last attack the aircraft switch in loop between Mission::Enter & Mission::Guard, making it impossible to land in the dock)
-						if (pUnit->IsInAir() && pUnit->CurrentMission != Mission::Enter)
-							pUnit->QueueMission(Mission::Enter, true);
-
-						return;
-					}
-				}
-				else if (pUnit->GetTechnoType()->Reload != 0) // Don't skip units that can reload themselves
-					return;
-			}
+			// Reset last target, at long term battles this prevented the aircraft to pick a new target (rare vanilla YR bug)
+			pUnit->SetTarget(nullptr);
+			pUnit->LastTarget = nullptr;
+			// Fix YR bug (when returns from the last attack the aircraft switch in loop between Mission::Enter & Mission::Guard, making it impossible to land in the dock)
+			if (pUnit->IsInAir() && pUnit->CurrentMission != Mission::Enter)
+				pUnit->QueueMission(Mission::Enter, true);
 		}
+
+		return;
 	}
 
 	pTeam->StepCompleted = true;
@@ -417,13 +496,7 @@ void ScriptExt::Mission_Gather_NearTheLeader(TeamClass* pTeam, int countdown = -
 		double closeEnough;
 
 		// Find the Leader
-		pLeaderUnit = pExt->TeamLeader;
-
-		if (!IsUnitAvailable(pLeaderUnit, true))
-		{
-			pLeaderUnit = FindTheTeamLeader(pTeam);
-			pExt->TeamLeader = pLeaderUnit;
-		}
+		pLeaderUnit = pExt->GetTeamLeader();
 
 		if (!pLeaderUnit)
 		{
@@ -557,25 +630,9 @@ void ScriptExt::IncreaseCurrentTriggerWeight(TeamClass* pTeam, bool forceJumpLin
 
 void ScriptExt::ModifyCurrentTriggerWeight(TeamClass* pTeam, bool forceJumpLine = true, double modifier = 0)
 {
-	AITriggerTypeClass* pTriggerType = nullptr;
-	auto pTeamType = pTeam->Type;
-	bool found = false;
-
-	for (int i = 0; i < AITriggerTypeClass::Array->Count && !found; i++)
-	{
-		auto pTriggerTeam1Type = AITriggerTypeClass::Array->GetItem(i)->Team1;
-		auto pTriggerTeam2Type = AITriggerTypeClass::Array->GetItem(i)->Team2;
-
-		if (pTeamType
-			&& ((pTriggerTeam1Type && pTriggerTeam1Type == pTeamType)
-				|| (pTriggerTeam2Type && pTriggerTeam2Type == pTeamType)))
-		{
-			found = true;
-			pTriggerType = AITriggerTypeClass::Array->GetItem(i);
-		}
-	}
+	auto const pTriggerType = ScriptExt::FindTriggerTypeForTeam(pTeam->Type);
 
-	if (found)
+	if (pTriggerType)
 	{
 		pTriggerType->Weight_Current += modifier;
 
@@ -879,7 +936,20 @@ void ScriptExt::SkipNextAction(TeamClass* pTeam, int successPercentage = 0)
 	pTeam->StepCompleted = true;
 }
 
-void ScriptExt::VariablesHandler(TeamClass* pTeam, PhobosScripts eAction, int nArg)
+// Operands are split from the argument when the line is compiled
+template<bool IsGlobal, class _Pr>
+static void ScriptExt_VariableOperationLine(TeamClass* pTeam, const ScriptExt::ScriptLine& line)
+{
+	ScriptExt::VariableOperationHandler<IsGlobal, _Pr>(pTeam, line.LoArgument, line.HiArgument);
+}
+
+template<bool IsSrcGlobal, bool IsGlobal, class _Pr>
+static void ScriptExt_VariableBinaryOperationLine(TeamClass* pTeam, const ScriptExt::ScriptLine& line)
+{
+	ScriptExt::VariableBinaryOperationHandler<IsSrcGlobal, IsGlobal, _Pr>(pTeam, line.LoArgument, line.HiArgument);
+}
+
+ScriptExt::ScriptLine::Handler ScriptExt::GetVariableHandler(PhobosScripts eAction)
 {
 	struct operation_set { int operator()(const int& a, const int& b) { return b; } };
 	struct operation_add { int operator()(const int& a, const int& b) { return a + b; } };
@@ -894,170 +964,166 @@ void ScriptExt::VariablesHandler(TeamClass* pTeam, PhobosScripts eAction, int nA
 	struct operation_or { int operator()(const int& a, const int& b) { return a | b; } };
 	struct operation_and { int operator()(const int& a, const int& b) { return a & b; } };
 
-	int nLoArg = LOWORD(nArg);
-	int nHiArg = HIWORD(nArg);
-
 	switch (eAction)
 	{
 	case PhobosScripts::LocalVariableSet:
-		VariableOperationHandler<false, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_set>;
 	case PhobosScripts::LocalVariableAdd:
-		VariableOperationHandler<false, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_add>;
 	case PhobosScripts::LocalVariableMinus:
-		VariableOperationHandler<false, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_minus>;
 	case PhobosScripts::LocalVariableMultiply:
-		VariableOperationHandler<false, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_multiply>;
 	case PhobosScripts::LocalVariableDivide:
-		VariableOperationHandler<false, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_divide>;
 	case PhobosScripts::LocalVariableMod:
-		VariableOperationHandler<false, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_mod>;
 	case PhobosScripts::LocalVariableLeftShift:
-		VariableOperationHandler<false, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_leftshift>;
 	case PhobosScripts::LocalVariableRightShift:
-		VariableOperationHandler<false, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_rightshift>;
 	case PhobosScripts::LocalVariableReverse:
-		VariableOperationHandler<false, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_reverse>;
 	case PhobosScripts::LocalVariableXor:
-		VariableOperationHandler<false, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_xor>;
 	case PhobosScripts::LocalVariableOr:
-		VariableOperationHandler<false, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_or>;
 	case PhobosScripts::LocalVariableAnd:
-		VariableOperationHandler<false, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<false, operation_and>;
 	case PhobosScripts::GlobalVariableSet:
-		VariableOperationHandler<true, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_set>;
 	case PhobosScripts::GlobalVariableAdd:
-		VariableOperationHandler<true, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_add>;
 	case PhobosScripts::GlobalVariableMinus:
-		VariableOperationHandler<true, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_minus>;
 	case PhobosScripts::GlobalVariableMultiply:
-		VariableOperationHandler<true, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_multiply>;
 	case PhobosScripts::GlobalVariableDivide:
-		VariableOperationHandler<true, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_divide>;
 	case PhobosScripts::GlobalVariableMod:
-		VariableOperationHandler<true, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_mod>;
 	case PhobosScripts::GlobalVariableLeftShift:
-		VariableOperationHandler<true, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_leftshift>;
 	case PhobosScripts::GlobalVariableRightShift:
-		VariableOperationHandler<true, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_rightshift>;
 	case PhobosScripts::GlobalVariableReverse:
-		VariableOperationHandler<true, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_reverse>;
 	case PhobosScripts::GlobalVariableXor:
-		VariableOperationHandler<true, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_xor>;
 	case PhobosScripts::GlobalVariableOr:
-		VariableOperationHandler<true, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_or>;
 	case PhobosScripts::GlobalVariableAnd:
-		VariableOperationHandler<true, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableOperationLine<true, operation_and>;
 	case PhobosScripts::LocalVariableSetByLocal:
-		VariableBinaryOperationHandler<false, false, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_set>;
 	case PhobosScripts::LocalVariableAddByLocal:
-		VariableBinaryOperationHandler<false, false, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_add>;
 	case PhobosScripts::LocalVariableMinusByLocal:
-		VariableBinaryOperationHandler<false, false, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_minus>;
 	case PhobosScripts::LocalVariableMultiplyByLocal:
-		VariableBinaryOperationHandler<false, false, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_multiply>;
 	case PhobosScripts::LocalVariableDivideByLocal:
-		VariableBinaryOperationHandler<false, false, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_divide>;
 	case PhobosScripts::LocalVariableModByLocal:
-		VariableBinaryOperationHandler<false, false, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_mod>;
 	case PhobosScripts::LocalVariableLeftShiftByLocal:
-		VariableBinaryOperationHandler<false, false, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_leftshift>;
 	case PhobosScripts::LocalVariableRightShiftByLocal:
-		VariableBinaryOperationHandler<false, false, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_rightshift>;
 	case PhobosScripts::LocalVariableReverseByLocal:
-		VariableBinaryOperationHandler<false, false, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_reverse>;
 	case PhobosScripts::LocalVariableXorByLocal:
-		VariableBinaryOperationHandler<false, false, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_xor>;
 	case PhobosScripts::LocalVariableOrByLocal:
-		VariableBinaryOperationHandler<false, false, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_or>;
 	case PhobosScripts::LocalVariableAndByLocal:
-		VariableBinaryOperationHandler<false, false, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, false, operation_and>;
 	case PhobosScripts::GlobalVariableSetByLocal:
-		VariableBinaryOperationHandler<false, true, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_set>;
 	case PhobosScripts::GlobalVariableAddByLocal:
-		VariableBinaryOperationHandler<false, true, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_add>;
 	case PhobosScripts::GlobalVariableMinusByLocal:
-		VariableBinaryOperationHandler<false, true, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_minus>;
 	case PhobosScripts::GlobalVariableMultiplyByLocal:
-		VariableBinaryOperationHandler<false, true, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_multiply>;
 	case PhobosScripts::GlobalVariableDivideByLocal:
-		VariableBinaryOperationHandler<false, true, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_divide>;
 	case PhobosScripts::GlobalVariableModByLocal:
-		VariableBinaryOperationHandler<false, true, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_mod>;
 	case PhobosScripts::GlobalVariableLeftShiftByLocal:
-		VariableBinaryOperationHandler<false, true, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_leftshift>;
 	case PhobosScripts::GlobalVariableRightShiftByLocal:
-		VariableBinaryOperationHandler<false, true, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_rightshift>;
 	case PhobosScripts::GlobalVariableReverseByLocal:
-		VariableBinaryOperationHandler<false, true, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_reverse>;
 	case PhobosScripts::GlobalVariableXorByLocal:
-		VariableBinaryOperationHandler<false, true, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_xor>;
 	case PhobosScripts::GlobalVariableOrByLocal:
-		VariableBinaryOperationHandler<false, true, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_or>;
 	case PhobosScripts::GlobalVariableAndByLocal:
-		VariableBinaryOperationHandler<false, true, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<false, true, operation_and>;
 	case PhobosScripts::LocalVariableSetByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_set>;
 	case PhobosScripts::LocalVariableAddByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_add>;
 	case PhobosScripts::LocalVariableMinusByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_minus>;
 	case PhobosScripts::LocalVariableMultiplyByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_multiply>;
 	case PhobosScripts::LocalVariableDivideByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_divide>;
 	case PhobosScripts::LocalVariableModByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_mod>;
 	case PhobosScripts::LocalVariableLeftShiftByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_leftshift>;
 	case PhobosScripts::LocalVariableRightShiftByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_rightshift>;
 	case PhobosScripts::LocalVariableReverseByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_reverse>;
 	case PhobosScripts::LocalVariableXorByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_xor>;
 	case PhobosScripts::LocalVariableOrByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_or>;
 	case PhobosScripts::LocalVariableAndByGlobal:
-		VariableBinaryOperationHandler<true, false, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, false, operation_and>;
 	case PhobosScripts::GlobalVariableSetByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_set>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_set>;
 	case PhobosScripts::GlobalVariableAddByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_add>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_add>;
 	case PhobosScripts::GlobalVariableMinusByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_minus>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_minus>;
 	case PhobosScripts::GlobalVariableMultiplyByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_multiply>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_multiply>;
 	case PhobosScripts::GlobalVariableDivideByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_divide>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_divide>;
 	case PhobosScripts::GlobalVariableModByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_mod>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_mod>;
 	case PhobosScripts::GlobalVariableLeftShiftByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_leftshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_leftshift>;
 	case PhobosScripts::GlobalVariableRightShiftByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_rightshift>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_rightshift>;
 	case PhobosScripts::GlobalVariableReverseByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_reverse>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_reverse>;
 	case PhobosScripts::GlobalVariableXorByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_xor>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_xor>;
 	case PhobosScripts::GlobalVariableOrByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_or>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_or>;
 	case PhobosScripts::GlobalVariableAndByGlobal:
-		VariableBinaryOperationHandler<true, true, operation_and>(pTeam, nLoArg, nHiArg); break;
+		return &ScriptExt_VariableBinaryOperationLine<true, true, operation_and>;
+	default:
+		return nullptr;
 	}
 }
 
 template<bool IsGlobal, class _Pr>
 void ScriptExt::VariableOperationHandler(TeamClass* pTeam, int nVariable, int Number)
 {
-	auto itr = ScenarioExt::Global()->Variables[IsGlobal].find(nVariable);
+	auto const pScenarioExt = ScenarioExt::Global();
 
-	if (itr != ScenarioExt::Global()->Variables[IsGlobal].end())
+	if (auto const pValue = pScenarioExt->Variables[IsGlobal].Find(nVariable))
 	{
-		itr->second.Value = _Pr()(itr->second.Value, Number);
-		if (IsGlobal)
-			TagClass::NotifyGlobalChanged(nVariable);
-		else
-			TagClass::NotifyLocalChanged(nVariable);
+		*pValue = _Pr()(*pValue, Number);
+		pScenarioExt->NotifyVariableChanged(IsGlobal, nVariable);
 	}
 
 	pTeam->StepCompleted = true;
@@ -1066,39 +1132,19 @@ void ScriptExt::VariableOperationHandler(TeamClass* pTeam, int nVariable, int Nu
 template<bool IsSrcGlobal, bool IsGlobal, class _Pr>
 void ScriptExt::VariableBinaryOperationHandler(TeamClass* pTeam, int nVariable, int nVarToOperate)
 {
-	auto itr = ScenarioExt::Global()->Variables[IsSrcGlobal].find(nVarToOperate);
-
-	if (itr != ScenarioExt::Global()->Variables[IsSrcGlobal].end())
-		VariableOperationHandler<IsGlobal, _Pr>(pTeam, nVariable, itr->second.Value);
+	if (auto const pValue = ScenarioExt::Global()->Variables[IsSrcGlobal].Find(nVarToOperate))
+		VariableOperationHandler<IsGlobal, _Pr>(pTeam, nVariable, *pValue);
 
 	pTeam->StepCompleted = true;
 }
 
 FootClass* ScriptExt::FindTheTeamLeader(TeamClass* pTeam)
 {
-	FootClass* pLeaderUnit = nullptr;
-	int bestUnitLeadershipValue = -1;
-
 	if (!pTeam)
-		return pLeaderUnit;
-
-	// Find the Leader or promote a new one
-	for (auto pUnit = pTeam->FirstUnit; pUnit; pUnit = pUnit->NextTeamMember)
-	{
-		if (!IsUnitAvailable(pUnit, true) || !(pUnit->IsInitiated || pUnit->WhatAmI() == AbstractType::Aircraft))
-			continue;
-
-		// The team Leader will be used for selecting targets, if there are living Team Members then always exists 1 Leader.
-		int unitLeadershipRating = pUnit->GetTechnoType()->LeadershipRating;
+		return nullptr;
 
-		if (unitLeadershipRating > bestUnitLeadershipValue)
-		{
-			pLeaderUnit = pUnit;
-			bestUnitLeadershipValue = unitLeadershipRating;
-		}
-	}
-
-	return pLeaderUnit;
+	auto const pExt = TeamExt::ExtMap.Find(pTeam);
+	return pExt ? pExt->GetMemberSummary().BestLeader : nullptr;
 }
 
 bool ScriptExt::IsExtVariableAction(int action)
@@ -1279,6 +1325,59 @@ void ScriptExt::ChronoshiftTeamToTarget(TeamClass* pTeam, TechnoClass* pTeamLead
 	return;
 }
 
+void ScriptExt::RebuildTeamTriggerIndex()
+{
+	auto const& triggers = *AITriggerTypeClass::Array;
+	TeamTriggerIndex.clear();
+	TeamTriggerIndex.reserve(triggers.Count * 2);
+
+	// Keep the first trigger for each team, matching the original linear scan
+	for (auto const pTriggerType : triggers)
+	{
+		if (pTriggerType->Team1)
+			TeamTriggerIndex.try_emplace(pTriggerType->Team1, pTriggerType);
+
+		if (pTriggerType->Team2)
+			TeamTriggerIndex.try_emplace(pTriggerType->Team2, pTriggerType);
+	}
+
+	TeamTriggerIndexCount = triggers.Count;
+}
+
+AITriggerTypeClass* ScriptExt::FindTriggerTypeForTeam(TeamTypeClass* pTeamType)
+{
+	if (!pTeamType)
+		return nullptr;
+
+	if (TeamTriggerIndexCount != AITriggerTypeClass::Array->Count)
+		ScriptExt::RebuildTeamTriggerIndex();
+
+	auto const it = TeamTriggerIndex.find(pTeamType);
+
+	if (it == TeamTriggerIndex.end())
+		return nullptr;
+
+	auto const pTriggerType = it->second;
+
+	// Team assignments can be changed by the map after the index was built
+	if (pTriggerType->Team1 != pTeamType && pTriggerType->Team2 != pTeamType)
+	{
+		ScriptExt::RebuildTeamTriggerIndex();
+		auto const retry = TeamTriggerIndex.find(pTeamType);
+		return retry != TeamTriggerIndex.end() ? retry->second : nullptr;
+	}
+
+	return pTriggerType;
+}
+
+void ScriptExt::Clear()
+{
+	CompiledScripts.clear();
+	TeamTriggerIndex.clear();
+	TeamTriggerIndexCount = -1;
+	ScriptExt::ExtMap.Clear();
+}
+
 bool ScriptExt::IsUnitAvailable(TechnoClass* pTechno, bool checkIfInTransportOrAbsorbed)
 {
 	if (!pTechno)
@@ -162,6 +162,20 @@ public:
 
 	static constexpr DWORD Canary = 0x3B3B3B3B;
 
+	// Script line decoded once per script type, see ScriptExt::GetCompiledScript()
+	struct ScriptLine
+	{
+		using Handler = void(*)(TeamClass* pTeam, const ScriptLine& line);
+
+		Handler Execute; // nullptr for actions handled by the game
+		int Action;
+		int Argument;
+		int LoArgument;
+		int HiArgument;
+		const std::vector<TechnoTypeClass*>* TargetTypes; // [AITargetTypes] list named by the argument
+		const std::vector<ScriptTypeClass*>* Scripts; // [AIScriptsList] list named by the argument
+	};
+
 	class ExtData final : public Extension<ScriptClass>
 	{
 	public:
@@ -208,9 +222,11 @@ public:
 	static void Stop_ForceJump_Countdown(TeamClass* pTeam);
 	static void JumpBackToPreviousScript(TeamClass* pTeam);
 	static void ChronoshiftToEnemyBase(TeamClass* pTeam, int extraDistance);
+	static AITriggerTypeClass* FindTriggerTypeForTeam(TeamTypeClass* pTeamType);
+	static void Clear();
 
 	static bool IsExtVariableAction(int action);
-	static void VariablesHandler(TeamClass* pTeam, PhobosScripts eAction, int nArg);
+	static ScriptLine::Handler GetVariableHandler(PhobosScripts eAction);
 	template<bool IsGlobal, class _Pr>
 	static void VariableOperationHandler(TeamClass* pTeam, int nVariable, int Number);
 	template<bool IsSrcGlobal, bool IsGlobal, class _Pr>
@@ -234,7 +250,18 @@ public:
 	static void Mission_Move_List1Random(TeamClass* pTeam, int calcThreatMode, bool pickAllies, int attackAITargetType, int idxAITargetTypeItem);
 
 private:
+	static const std::vector<ScriptLine>& GetCompiledScript(ScriptTypeClass* pType);
+	static void CompileScript(ScriptTypeClass* pType, std::vector<ScriptLine>& lines);
+	static ScriptLine::Handler GetLineHandler(const ScriptLine& compiled);
 	static void ModifyCurrentTriggerWeight(TeamClass* pTeam, bool forceJumpLine, double modifier);
 	static bool MoveMissionEndStatus(TeamClass* pTeam, TechnoClass* pFocus, FootClass* pLeader, int mode);
 	static void ChronoshiftTeamToTarget(TeamClass* pTeam, TechnoClass* pTeamLeader, AbstractClass* pTarget);
+	static void RebuildTeamTriggerIndex();
+
+	// First AI trigger type referencing each team type, rebuilt when the trigger count changes
+	static std::unordered_map<TeamTypeClass*, AITriggerTypeClass*> TeamTriggerIndex;
+	static int TeamTriggerIndexCount;
+
+	// Decoded lines for each script type that ran this scenario
+	static std::unordered_map<ScriptTypeClass*, std::vector<ScriptLine>> CompiledScripts;
 };
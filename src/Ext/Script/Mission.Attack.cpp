@@ -113,41 +113,13 @@ void ScriptExt::Mission_Attack(TeamClass* pTeam, bool repeatAction = true, int c
 		}
 	}
 
-	for (auto pFoot = pTeam->FirstUnit; pFoot; pFoot = pFoot->NextTeamMember)
-	{
-		if (IsUnitAvailable(pFoot, true))
-		{
-			auto const pTechnoType = pFoot->GetTechnoType();
-
-			if (pFoot->WhatAmI() == AbstractType::Aircraft
-				&& !pFoot->IsInAir()
-				&& static_cast<AircraftTypeClass*>(pTechnoType)->AirportBound
-				&& pFoot->Ammo < pTechnoType->Ammo)
-			{
-				bAircraftsWithoutAmmo = true;
-			}
-
-			pacifistTeam &= !IsUnitArmed(pFoot);
-
-			if (pFoot->WhatAmI() == AbstractType::Infantry)
-			{
-				auto const pTypeInf = static_cast<InfantryTypeClass*>(pTechnoType);
-
-				// Any Team member (infantry) is a special agent? If yes ignore some checks based on Weapons.
-				if ((pTypeInf->Agent && pTypeInf->Infiltrate) || pTypeInf->Engineer)
-					agentMode = true;
-			}
-		}
-	}
+	auto const& members = pTeamData->GetMemberSummary();
+	bAircraftsWithoutAmmo = members.HasAircraftWithoutAmmo;
+	pacifistTeam = members.IsPacifist;
+	agentMode = members.HasAgent;
 
 	// Find the Leader
-	pLeaderUnit = pTeamData->TeamLeader;
-
-	if (!IsUnitAvailable(pLeaderUnit, true))
-	{
-		pLeaderUnit = FindTheTeamLeader(pTeam);
-		pTeamData->TeamLeader = pLeaderUnit;
-	}
+	pLeaderUnit = pTeamData->GetTeamLeader();
 
 	if (!pLeaderUnit || bAircraftsWithoutAmmo || (pacifistTeam && !agentMode))
 	{
@@ -601,15 +573,7 @@ bool ScriptExt::EvaluateObjectWithMask(TechnoClass* pTechno, int mask, int attac
 
 	// Special case: validate target if is part of a technos list in [AITargetTypes] section
 	if (attackAITargetType >= 0 && RulesExt::Global()->AITargetTypesLists.size() > 0)
-	{
-		for (auto item : RulesExt::Global()->AITargetTypesLists[attackAITargetType])
-		{
-			if (pTechnoType == item)
-				return true;
-		}
-
-		return false;
-	}
+		return TechnoTypeExt::ExtMap.Find(pTechnoType)->IsInAITargetTypesList(attackAITargetType);
 
 	switch (mask)
 	{
@@ -1159,21 +1123,16 @@ void ScriptExt::Mission_Attack_List1Random(TeamClass* pTeam, bool repeatAction,
 			for (int i = 0; i < TechnoClass::Array->Count; i++)
 			{
 				auto pTechno = TechnoClass::Array->GetItem(i);
-				auto pTechnoType = TechnoClass::Array->GetItem(i)->GetTechnoType();
-				bool found = false;
+				auto pTechnoType = pTechno->GetTechnoType();
+				auto const pFirstUnit = pTeam->FirstUnit;
 
-				for (auto j = 0u; j < objectsList.size() && !found; j++)
+				if (TechnoTypeExt::ExtMap.Find(pTechnoType)->IsInAITargetTypesList(attackAITargetType)
+					&& IsUnitAvailable(pTechno, true)
+					&& (!pFirstUnit->Owner->IsAlliedWith(pTechno) || IsUnitMindControlledFriendly(pFirstUnit->Owner, pTechno)))
 				{
-					auto objectFromList = objectsList[j];
-					auto const pFirstUnit = pTeam->FirstUnit;
-
-					if (pTechnoType == objectFromList
-						&& IsUnitAvailable(pTechno, true)
-						&& (!pFirstUnit->Owner->IsAlliedWith(pTechno) || IsUnitMindControlledFriendly(pFirstUnit->Owner, pTechno)))
-					{
-						validIndexes.push_back(j);
-						found = true;
-					}
+					// The first occurrence in the list is the one that gets picked
+					auto const it = std::find(objectsList.begin(), objectsList.end(), pTechnoType);
+					validIndexes.push_back(static_cast<int>(it - objectsList.begin()));
 				}
 			}
 
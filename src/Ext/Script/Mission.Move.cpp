@@ -54,30 +54,10 @@ void ScriptExt::Mission_Move(TeamClass* pTeam, int calcThreatMode = 0, bool pick
 		return;
 	}
 
-	for (auto pFoot = pTeam->FirstUnit; pFoot; pFoot = pFoot->NextTeamMember)
-	{
-		if (pFoot && pFoot->IsAlive && !pFoot->InLimbo)
-		{
-			auto const pTechnoType = pFoot->GetTechnoType();
-
-			if (pFoot->WhatAmI() == AbstractType::Aircraft
-				&& !pFoot->IsInAir()
-				&& static_cast<AircraftTypeClass*>(pTechnoType)->AirportBound
-				&& pFoot->Ammo < pTechnoType->Ammo)
-			{
-				bAircraftsWithoutAmmo = true;
-			}
-		}
-	}
+	bAircraftsWithoutAmmo = pTeamData->GetMemberSummary().HasAircraftWithoutAmmo;
 
 	// Find the Leader
-	pLeaderUnit = pTeamData->TeamLeader;
-
-	if (!IsUnitAvailable(pLeaderUnit, true))
-	{
-		pLeaderUnit = FindTheTeamLeader(pTeam);
-		pTeamData->TeamLeader = pLeaderUnit;
-	}
+	pLeaderUnit = pTeamData->GetTeamLeader();
 
 	if (!pLeaderUnit || bAircraftsWithoutAmmo)
 	{
@@ -399,23 +379,18 @@ void ScriptExt::Mission_Move_List1Random(TeamClass* pTeam, int calcThreatMode, b
 			for (int i = 0; i < TechnoClass::Array->Count; i++)
 			{
 				auto pTechno = TechnoClass::Array->GetItem(i);
-				auto pTechnoType = TechnoClass::Array->GetItem(i)->GetTechnoType();
-				bool found = false;
-
-				for (auto j = 0u; j < objectsList.size() && !found; j++)
+				auto pTechnoType = pTechno->GetTechnoType();
+
+				if (TechnoTypeExt::ExtMap.Find(pTechnoType)->IsInAITargetTypesList(attackAITargetType)
+					&& IsUnitAvailable(pTechno, true)
+					&& ((pickAllies
+						&& pTeam->FirstUnit->Owner->IsAlliedWith(pTechno))
+						|| (!pickAllies
+							&& !pTeam->FirstUnit->Owner->IsAlliedWith(pTechno))))
 				{
-					auto objectFromList = objectsList[j];
-
-					if (pTechnoType == objectFromList
-						&& IsUnitAvailable(pTechno, true)
-						&& ((pickAllies
-							&& pTeam->FirstUnit->Owner->IsAlliedWith(pTechno))
-							|| (!pickAllies
-								&& !pTeam->FirstUnit->Owner->IsAlliedWith(pTechno))))
-					{
-						validIndexes.push_back(j);
-						found = true;
-					}
+					// The first occurrence in the list is the one that gets picked
+					auto const it = std::find(objectsList.begin(), objectsList.end(), pTechnoType);
+					validIndexes.push_back(static_cast<int>(it - objectsList.begin()));
 				}
 			}
 
@@ -78,16 +78,10 @@ bool TActionExt::Execute(TActionClass* pThis, HouseClass* pHouse, ObjectClass* p
 
 bool TActionExt::PlayAudioAtRandomWP(TActionClass* pThis, HouseClass* pHouse, ObjectClass* pObject, TriggerClass* pTrigger, CellStruct const& location)
 {
-	std::vector<int> waypoints;
-	waypoints.reserve(ScenarioExt::Global()->Waypoints.size());
-
+	auto const& waypoints = ScenarioExt::Global()->Waypoints.GetDefinedIndices();
 	auto const pScen = ScenarioClass::Instance();
 
-	for (auto pair : ScenarioExt::Global()->Waypoints)
-		if (pScen->IsDefinedWaypoint(pair.first))
-			waypoints.push_back(pair.first);
-
-	if (waypoints.size() > 0)
+	if (!waypoints.empty())
 	{
 		auto const index = pScen->Random.RandomRanged(0, waypoints.size() - 1);
 		auto const luckyWP = waypoints[index];
@@ -146,11 +140,10 @@ bool TActionExt::EditVariable(TActionClass* pThis, HouseClass* pHouse, ObjectCla
 	// holds by pThis->Param5
 
 	// uses !pThis->Param5 to ensure Param5 is 0 or 1
-	auto& variables = ScenarioExt::Global()->Variables[pThis->Param5 != 0];
-	auto itr = variables.find(pThis->Value);
-	if (itr != variables.end())
+	auto const pScenarioExt = ScenarioExt::Global();
+	if (auto const pValue = pScenarioExt->Variables[pThis->Param5 != 0].Find(pThis->Value))
 	{
-		auto& nCurrentValue = itr->second.Value;
+		auto& nCurrentValue = *pValue;
 		// variable being found
 		switch (pThis->Param3)
 		{
@@ -170,25 +163,18 @@ bool TActionExt::EditVariable(TActionClass* pThis, HouseClass* pHouse, ObjectCla
 			return true;
 		}
 
-		if (!pThis->Param5)
-			TagClass::NotifyLocalChanged(pThis->Value);
-		else
-			TagClass::NotifyGlobalChanged(pThis->Value);
+		pScenarioExt->NotifyVariableChanged(pThis->Param5 != 0, pThis->Value);
 	}
 	return true;
 }
 
 bool TActionExt::GenerateRandomNumber(TActionClass* pThis, HouseClass* pHouse, ObjectClass* pObject, TriggerClass* pTrigger, CellStruct const& location)
 {
-	auto& variables = ScenarioExt::Global()->Variables[pThis->Param5 != 0];
-	auto itr = variables.find(pThis->Value);
-	if (itr != variables.end())
+	auto const pScenarioExt = ScenarioExt::Global();
+	if (auto const pValue = pScenarioExt->Variables[pThis->Param5 != 0].Find(pThis->Value))
 	{
-		itr->second.Value = ScenarioClass::Instance->Random.RandomRanged(pThis->Param3, pThis->Param4);
-		if (!pThis->Param5)
-			TagClass::NotifyLocalChanged(pThis->Value);
-		else
-			TagClass::NotifyGlobalChanged(pThis->Value);
+		*pValue = ScenarioClass::Instance->Random.RandomRanged(pThis->Param3, pThis->Param4);
+		pScenarioExt->NotifyVariableChanged(pThis->Param5 != 0, pThis->Value);
 	}
 
 	return true;
@@ -196,11 +182,9 @@ bool TActionExt::GenerateRandomNumber(TActionClass* pThis, HouseClass* pHouse, O
 
 bool TActionExt::PrintVariableValue(TActionClass* pThis, HouseClass* pHouse, ObjectClass* pObject, TriggerClass* pTrigger, CellStruct const& location)
 {
-	auto& variables = ScenarioExt::Global()->Variables[pThis->Param3 != 0];
-	auto itr = variables.find(pThis->Value);
-	if (itr != variables.end())
+	if (auto const pValue = ScenarioExt::Global()->Variables[pThis->Param3 != 0].Find(pThis->Value))
 	{
-		CRT::swprintf(Phobos::wideBuffer, L"%d", itr->second.Value);
+		CRT::swprintf(Phobos::wideBuffer, L"%d", *pValue);
 		MessageListClass::Instance->PrintMessage(Phobos::wideBuffer);
 	}
 
@@ -209,15 +193,14 @@ bool TActionExt::PrintVariableValue(TActionClass* pThis, HouseClass* pHouse, Obj
 
 bool TActionExt::BinaryOperation(TActionClass* pThis, HouseClass* pHouse, ObjectClass* pObject, TriggerClass* pTrigger, CellStruct const& location)
 {
-	auto& variables1 = ScenarioExt::Global()->Variables[pThis->Param5 != 0];
-	auto itr1 = variables1.find(pThis->Value);
-	auto& variables2 = ScenarioExt::Global()->Variables[pThis->Param6 != 0];
-	auto itr2 = variables2.find(pThis->Param4);
+	auto const pScenarioExt = ScenarioExt::Global();
+	auto const pValue1 = pScenarioExt->Variables[pThis->Param5 != 0].Find(pThis->Value);
+	auto const pValue2 = pScenarioExt->Variables[pThis->Param6 != 0].Find(pThis->Param4);
 
-	if (itr1 != variables1.end() && itr2 != variables2.end())
+	if (pValue1 && pValue2)
 	{
-		auto& nCurrentValue = itr1->second.Value;
-		auto& nOptValue = itr2->second.Value;
+		auto& nCurrentValue = *pValue1;
+		auto& nOptValue = *pValue2;
 		switch (pThis->Param3)
 		{
 		case 0: { nCurrentValue = nOptValue; break; }
@@ -236,10 +219,7 @@ bool TActionExt::BinaryOperation(TActionClass* pThis, HouseClass* pHouse, Object
 			return true;
 		}
 
-		if (!pThis->Param5)
-			TagClass::NotifyLocalChanged(pThis->Value);
-		else
-			TagClass::NotifyGlobalChanged(pThis->Value);
+		pScenarioExt->NotifyVariableChanged(pThis->Param5 != 0, pThis->Value);
 	}
 	return true;
 }
@@ -259,13 +239,13 @@ bool TActionExt::RunSuperWeaponAtWaypoint(TActionClass* pThis, HouseClass* pHous
 	if (!pThis)
 		return true;
 
-	auto& waypoints = ScenarioExt::Global()->Waypoints;
+	auto const& waypoints = ScenarioExt::Global()->Waypoints;
 	int nWaypoint = pThis->Param5;
 
 	// Check if is a valid Waypoint
-	if (nWaypoint >= 0 && waypoints.find(nWaypoint) != waypoints.end() && waypoints[nWaypoint].X && waypoints[nWaypoint].Y)
+	if (waypoints.IsDefined(nWaypoint))
 	{
-		auto const selectedWP = waypoints[nWaypoint];
+		auto const selectedWP = waypoints.Get(nWaypoint);
 		TActionExt::RunSuperWeaponAt(pThis, selectedWP.X, selectedWP.Y);
 	}
 
@@ -9,8 +9,12 @@
 #include <AircraftClass.h>
 #include <HouseClass.h>
 
+#include <Utilities/Profiler.h>
+
 //Static init
 TEventExt::ExtContainer TEventExt::ExtMap;
+std::vector<TEventClass*> TEventExt::ResolvedEvents;
+int TEventExt::InputGenerations[static_cast<int>(PhobosTriggerInput::Count)] {};
 
 // =============================
 // load / save
@@ -33,8 +37,50 @@ void TEventExt::ExtData::SaveToStream(PhobosStreamWriter& Stm)
 	this->Serialize(Stm);
 }
 
+DEFINE_PROFILE_SECTION(Profile_TEvents_Evaluated, "PhobosTEvents_Evaluated");
+DEFINE_PROFILE_SECTION(Profile_TEvents_Skipped, "PhobosTEvents_SkippedUnchanged");
+DEFINE_PROFILE_SECTION(Profile_TEvents_Triggered, "PhobosTEvents_Triggered");
+
 bool TEventExt::Execute(TEventClass* pThis, int iEvent, HouseClass* pHouse, ObjectClass* pObject,
 	CDTimerClass* pTimer, bool* isPersitant, TechnoClass* pSource, bool& bHandled)
+{
+	const int eventKind = static_cast<int>(pThis->EventKind);
+
+	if (eventKind < PhobosTriggerEvent::LocalVariableGreaterThan || eventKind >= PhobosTriggerEvent::_DummyMaximum)
+	{
+		bHandled = false;
+		return true;
+	}
+
+	auto const pExt = TEventExt::GetResolvedData(pThis);
+
+	if (pExt->IsLastResultValid(pObject))
+	{
+		PROFILE_COUNT(Profile_TEvents_Skipped);
+
+		if (pExt->LastResult)
+			PROFILE_COUNT(Profile_TEvents_Triggered);
+
+		bHandled = true;
+		return pExt->LastResult;
+	}
+
+	const bool result = TEventExt::Evaluate(pThis, pHouse, pObject, bHandled);
+
+	if (!bHandled)
+		return result;
+
+	PROFILE_COUNT(Profile_TEvents_Evaluated);
+
+	if (result)
+		PROFILE_COUNT(Profile_TEvents_Triggered);
+
+	pExt->SetLastResult(result, pObject);
+
+	return result;
+}
+
+bool TEventExt::Evaluate(TEventClass* pThis, HouseClass* pHouse, ObjectClass* pObject, bool& bHandled)
 {
 	bHandled = true;
 	switch (static_cast<PhobosTriggerEvent>(pThis->EventKind))
@@ -137,47 +183,28 @@ bool TEventExt::Execute(TEventClass* pThis, int iEvent, HouseClass* pHouse, Obje
 template<bool IsGlobal, class _Pr>
 bool TEventExt::VariableCheck(TEventClass* pThis)
 {
-	auto itr = ScenarioExt::Global()->Variables[IsGlobal].find(pThis->Value);
-
-	if (itr != ScenarioExt::Global()->Variables[IsGlobal].end())
-	{
-		// We uses TechnoName for our operator number
-		int nOpt = atoi(pThis->String);
-		return _Pr()(itr->second.Value, nOpt);
-	}
-
-	return false;
+	// We uses TechnoName for our operator number
+	auto const pValue = ScenarioExt::Global()->Variables[IsGlobal].Find(pThis->Value);
+	return pValue && _Pr()(*pValue, TEventExt::GetResolvedData(pThis)->Operand);
 }
 
 template<bool IsSrcGlobal, bool IsGlobal, class _Pr>
 bool TEventExt::VariableCheckBinary(TEventClass* pThis)
 {
-	auto itr = ScenarioExt::Global()->Variables[IsGlobal].find(pThis->Value);
-
-	if (itr != ScenarioExt::Global()->Variables[IsGlobal].end())
-	{
-		// We uses TechnoName for our src variable index
-		int nSrcVariable = atoi(pThis->String);
-		auto itrsrc = ScenarioExt::Global()->Variables[IsSrcGlobal].find(nSrcVariable);
-
-		if (itrsrc != ScenarioExt::Global()->Variables[IsSrcGlobal].end())
-			return _Pr()(itr->second.Value, itrsrc->second.Value);
-	}
-
-	return false;
+	// We uses TechnoName for our src variable index
+	auto const pValue = ScenarioExt::Global()->Variables[IsGlobal].Find(pThis->Value);
+	auto const pSrcValue = ScenarioExt::Global()->Variables[IsSrcGlobal].Find(TEventExt::GetResolvedData(pThis)->Operand);
+	return pValue && pSrcValue && _Pr()(*pValue, *pSrcValue);
 }
 
 bool TEventExt::HouseOwnsTechnoTypeTEvent(TEventClass* pThis)
 {
-	auto pType = TechnoTypeClass::Find(pThis->String);
-	if (!pType)
-		return false;
+	auto const pExt = TEventExt::GetResolvedData(pThis);
 
-	auto pHouse = HouseClass::Index_IsMP(pThis->Value) ? HouseClass::FindByIndex(pThis->Value) : HouseClass::FindByCountryIndex(pThis->Value);
-	if (!pHouse)
+	if (!pExt->ParametersValid || !pExt->House)
 		return false;
 
-	return pHouse->CountOwnedNow(pType) > 0;
+	return pExt->House->CountOwnedNow(pExt->TechnoType) > 0;
 }
 
 bool TEventExt::HouseDoesntOwnTechnoTypeTEvent(TEventClass* pThis)
@@ -190,46 +217,26 @@ bool TEventExt::CellHasAnyTechnoTypeFromListTEvent(TEventClass* pThis, ObjectCla
 	if (!pObject)
 		return false;
 
-	int desiredListIdx = -1;
-	if (sscanf_s(pThis->String, "%d", &desiredListIdx) <= 0 || desiredListIdx < 0)
-	{
-		Debug::Log("Error in event %d. The parameter 2 '%s' isn't a valid index value for [AITargetTypes]\n", static_cast<PhobosTriggerEvent>(pThis->EventKind), pThis->String);
+	auto const pExt = TEventExt::GetResolvedData(pThis);
+
+	if (!pExt->ParametersValid)
 		return false;
-	}
 
-	if (RulesExt::Global()->AITargetTypesLists.size() == 0
-		|| RulesExt::Global()->AITargetTypesLists[desiredListIdx].size() == 0)
-	{
+	auto const& desiredList = RulesExt::Global()->AITargetTypesLists[pExt->Operand];
+
+	if (desiredList.size() == 0)
 		return false;
-	}
 
 	auto const pTechno = abstract_cast<TechnoClass*>(pObject);
 	if (!pTechno)
 		return false;
 
-	auto const pTechnoType = pTechno->GetTechnoType();
-	bool found = false;
-
-	for (auto const pDesiredItem : RulesExt::Global()->AITargetTypesLists[desiredListIdx])
-	{
-		if (pDesiredItem == pTechnoType)
-		{
-			HouseClass* pHouse = nullptr;
-
-			if (pThis->Value <= -2)
-				pHouse = pEventHouse;
-			else if (pThis->Value >= 0)
-				pHouse = HouseClass::Index_IsMP(pThis->Value) ? HouseClass::FindByIndex(pThis->Value) : HouseClass::FindByCountryIndex(pThis->Value);
-
-			if (pHouse && pTechno->Owner != pHouse)
-				break;
+	if (!TechnoTypeExt::ExtMap.Find(pTechno->GetTechnoType())->IsInAITargetTypesList(pExt->Operand))
+		return false;
 
-			found = true;
-			break;
-		}
-	}
+	HouseClass* pHouse = pThis->Value <= -2 ? pEventHouse : pExt->House;
 
-	return found;
+	return !pHouse || pTechno->Owner == pHouse;
 }
 
 bool TEventExt::CellHasTechnoTypeTEvent(TEventClass* pThis, ObjectClass* pObject, HouseClass* pEventHouse)
@@ -237,12 +244,10 @@ bool TEventExt::CellHasTechnoTypeTEvent(TEventClass* pThis, ObjectClass* pObject
 	if (!pObject)
 		return false;
 
-	auto pDesiredType = TechnoTypeClass::Find(pThis->String);
-	if (!pDesiredType)
-	{
-		Debug::Log("Error in event %d. The parameter 2 '%s' isn't a valid Techno ID\n", static_cast<PhobosTriggerEvent>(pThis->EventKind), pThis->String);
+	auto const pExt = TEventExt::GetResolvedData(pThis);
+
+	if (!pExt->ParametersValid)
 		return false;
-	}
 
 	auto const pTechno = abstract_cast<TechnoClass*>(pObject);
 	if (!pTechno)
@@ -250,14 +255,9 @@ bool TEventExt::CellHasTechnoTypeTEvent(TEventClass* pThis, ObjectClass* pObject
 
 	auto const pTechnoType = pTechno->GetTechnoType();
 
-	if (pDesiredType == pTechnoType)
+	if (pExt->TechnoType == pTechnoType)
 	{
-		HouseClass* pHouse = nullptr;
-
-		if (pThis->Value <= -2)
-			pHouse = pEventHouse;
-		else if (pThis->Value >= 0)
-			pHouse = HouseClass::Index_IsMP(pThis->Value) ? HouseClass::FindByIndex(pThis->Value) : HouseClass::FindByCountryIndex(pThis->Value);
+		HouseClass* pHouse = pThis->Value <= -2 ? pEventHouse : pExt->House;
 
 		if (pHouse)
 		{
@@ -273,6 +273,192 @@ bool TEventExt::CellHasTechnoTypeTEvent(TEventClass* pThis, ObjectClass* pObject
 	return false;
 }
 
+// =============================
+// parameter resolving
+
+HouseClass* TEventExt::ResolveHouse(int index)
+{
+	if (index < 0)
+		return nullptr;
+
+	return HouseClass::Index_IsMP(index) ? HouseClass::FindByIndex(index) : HouseClass::FindByCountryIndex(index);
+}
+
+// Parses parameter 2 and looks up types & houses once instead of on every evaluation.
+void TEventExt::ExtData::ResolveParameters()
+{
+	auto const pThis = this->OwnerObject();
+	auto const eventKind = static_cast<PhobosTriggerEvent>(pThis->EventKind);
+
+	if (this->ResolvedKind != -1)
+		this->SubscribeToVariables(false);
+
+	this->NeedsEvaluation = true;
+	this->Input = PhobosTriggerInput::None;
+	this->ResolvedKind = static_cast<int>(pThis->EventKind);
+	this->ResolvedValue = pThis->Value;
+	this->Operand = 0;
+	this->TechnoType = nullptr;
+	this->House = nullptr;
+	this->ParametersValid = true;
+
+	switch (eventKind)
+	{
+	case PhobosTriggerEvent::ShieldBroken:
+		this->Input = PhobosTriggerInput::ShieldState;
+		break;
+
+	case PhobosTriggerEvent::HouseOwnsTechnoType:
+	case PhobosTriggerEvent::HouseDoesntOwnTechnoType:
+		this->Input = PhobosTriggerInput::TechnoOwnership;
+		[[fallthrough]];
+	case PhobosTriggerEvent::CellHasTechnoType:
+		this->TechnoType = TechnoTypeClass::Find(pThis->String);
+		this->House = TEventExt::ResolveHouse(pThis->Value);
+
+		if (!this->TechnoType)
+		{
+			Debug::Log("Error in event %d. The parameter 2 '%s' isn't a valid Techno ID\n", eventKind, pThis->String);
+			this->ParametersValid = false;
+		}
+
+		break;
+
+	case PhobosTriggerEvent::CellHasAnyTechnoTypeFromList:
+		this->House = TEventExt::ResolveHouse(pThis->Value);
+
+		if (sscanf_s(pThis->String, "%d", &this->Operand) <= 0 || this->Operand < 0
+			|| static_cast<size_t>(this->Operand) >= RulesExt::Global()->AITargetTypesLists.size())
+		{
+			Debug::Log("Error in event %d. The parameter 2 '%s' isn't a valid index value for [AITargetTypes]\n", eventKind, pThis->String);
+			this->ParametersValid = false;
+		}
+
+		break;
+
+	default:
+		if (eventKind >= PhobosTriggerEvent::LocalVariableGreaterThan && eventKind <= PhobosTriggerEvent::GlobalVariableAndIsTrueGlobalVariable)
+		{
+			this->Operand = atoi(pThis->String);
+			this->Input = PhobosTriggerInput::Variables;
+			this->SubscribeToVariables(true);
+		}
+
+		break;
+	}
+}
+
+void TEventExt::ExtData::SubscribeToVariables(bool subscribe)
+{
+	auto const pThis = this->OwnerObject();
+	auto const pScenarioExt = ScenarioExt::Global();
+
+	if (!subscribe)
+	{
+		pScenarioExt->Variables[0].Unsubscribe(pThis);
+		pScenarioExt->Variables[1].Unsubscribe(pThis);
+		return;
+	}
+
+	const int eventKind = this->ResolvedKind;
+
+	if (eventKind < PhobosTriggerEvent::LocalVariableGreaterThanLocalVariable)
+	{
+		// Unary: 500-505 local, 506-511 global.
+		pScenarioExt->Variables[eventKind >= PhobosTriggerEvent::GlobalVariableGreaterThan].Subscribe(pThis->Value, pThis);
+	}
+	else
+	{
+		// Binary: groups of 6 in order local-local, global-local, local-global, global-global.
+		const int group = (eventKind - PhobosTriggerEvent::LocalVariableGreaterThanLocalVariable) / 6;
+		const bool isGlobal = group == 1 || group == 3;
+		const bool isSrcGlobal = group >= 2;
+
+		pScenarioExt->Variables[isGlobal].Subscribe(pThis->Value, pThis);
+		pScenarioExt->Variables[isSrcGlobal].Subscribe(this->Operand, pThis);
+	}
+}
+
+void TEventExt::MarkForEvaluation(TEventClass* pThis)
+{
+	if (auto const pExt = TEventExt::ExtMap.Find(pThis))
+		pExt->NeedsEvaluation = true;
+}
+
+// Invalidates the last results of all events depending on the input without having to visit them.
+void TEventExt::Publish(PhobosTriggerInput input)
+{
+	if (input > PhobosTriggerInput::None && input < PhobosTriggerInput::Count)
+		++TEventExt::InputGenerations[static_cast<int>(input)];
+}
+
+bool TEventExt::ExtData::IsLastResultValid(ObjectClass* pObject) const
+{
+	switch (this->Input)
+	{
+	case PhobosTriggerInput::Variables:
+		return !this->NeedsEvaluation;
+	case PhobosTriggerInput::TechnoOwnership:
+		return !this->NeedsEvaluation && this->InputGeneration == TEventExt::InputGenerations[static_cast<int>(this->Input)];
+	case PhobosTriggerInput::ShieldState:
+		return !this->NeedsEvaluation && this->InputGeneration == TEventExt::InputGenerations[static_cast<int>(this->Input)]
+			&& this->LastObject == pObject;
+	default:
+		return false;
+	}
+}
+
+void TEventExt::ExtData::SetLastResult(bool result, ObjectClass* pObject)
+{
+	this->LastResult = result;
+	this->LastObject = pObject;
+	this->NeedsEvaluation = false;
+
+	if (this->Input > PhobosTriggerInput::None)
+		this->InputGeneration = TEventExt::InputGenerations[static_cast<int>(this->Input)];
+}
+
+TEventExt::ExtData* TEventExt::GetResolvedData(TEventClass* pThis)
+{
+	auto pExt = TEventExt::ExtMap.Find(pThis);
+
+	if (!pExt)
+	{
+		pExt = TEventExt::ExtMap.Allocate(pThis);
+		TEventExt::ResolvedEvents.push_back(pThis);
+	}
+
+	if (pExt->ResolvedKind != static_cast<int>(pThis->EventKind) || pExt->ResolvedValue != pThis->Value)
+		pExt->ResolveParameters();
+
+	return pExt;
+}
+
+void TEventExt::Clear()
+{
+	for (auto const pEvent : TEventExt::ResolvedEvents)
+		TEventExt::ExtMap.Remove(pEvent);
+
+	TEventExt::ResolvedEvents.clear();
+}
+
+void TEventExt::PointerGotInvalid(void* ptr, bool removed)
+{
+	auto const pEvent = static_cast<TEventClass*>(ptr);
+
+	if (!TEventExt::ExtMap.Find(pEvent))
+		return;
+
+	if (auto const pScenarioExt = ScenarioExt::Global())
+	{
+		pScenarioExt->Variables[0].Unsubscribe(pEvent);
+		pScenarioExt->Variables[1].Unsubscribe(pEvent);
+	}
+
+	TEventExt::ExtMap.Remove(pEvent);
+	TEventExt::ResolvedEvents.erase(std::remove(TEventExt::ResolvedEvents.begin(), TEventExt::ResolvedEvents.end(), pEvent), TEventExt::ResolvedEvents.end());
+}
+
 // =============================
 // container
 
@@ -8,6 +8,7 @@
 #include <TEventClass.h>
 
 class HouseClass;
+class TechnoTypeClass;
 
 enum PhobosTriggerEvent
 {
@@ -57,6 +58,18 @@ enum PhobosTriggerEvent
 	_DummyMaximum,
 };
 
+// Inputs Phobos trigger events depend on. Producers publish changes to these so that
+// events are only evaluated again after something they read has changed.
+enum class PhobosTriggerInput : int
+{
+	None = -1,            // Depends on the object or house the event is evaluated for, always evaluated.
+	Variables = 0,        // Subscribed per variable through ScenarioVariableTable.
+	TechnoOwnership = 1,  // Technos gained or lost by a house, (un)limboed, captured or converted.
+	ShieldState = 2,      // Shields created, removed, broken or respawned.
+
+	Count
+};
+
 class TEventExt
 {
 public:
@@ -67,11 +80,40 @@ public:
 	class ExtData final : public Extension<TEventClass>
 	{
 	public:
+		// Event parameters resolved on first evaluation, re-resolved if event kind or value no longer match.
+		int ResolvedKind;
+		int ResolvedValue;
+		int Operand;                  // Parameter 2 as number: variable operand, source variable index or AITargetTypes index.
+		TechnoTypeClass* TechnoType;  // Parameter 2 as TechnoType ID.
+		HouseClass* House;            // House from parameter 1 index, if applicable.
+		bool ParametersValid;
+		PhobosTriggerInput Input;
+		bool NeedsEvaluation;         // Set when any variable this event reads has changed.
+		int InputGeneration;          // Generation of Input at the last evaluation.
+		ObjectClass* LastObject;      // Object the last result was evaluated for, only compared against.
+		bool LastResult;
+
 		ExtData(TEventClass* const OwnerObject) : Extension<TEventClass>(OwnerObject)
+			, ResolvedKind { -1 }
+			, ResolvedValue { -1 }
+			, Operand { 0 }
+			, TechnoType { nullptr }
+			, House { nullptr }
+			, ParametersValid { false }
+			, Input { PhobosTriggerInput::None }
+			, NeedsEvaluation { true }
+			, InputGeneration { -1 }
+			, LastObject { nullptr }
+			, LastResult { false }
 		{ }
 
 		virtual ~ExtData() = default;
 
+		void ResolveParameters();
+		void SubscribeToVariables(bool subscribe);
+		bool IsLastResultValid(ObjectClass* pObject) const;
+		void SetLastResult(bool result, ObjectClass* pObject);
+
 		virtual void InvalidatePointer(void* ptr, bool bRemoved) override { }
 
 		virtual void LoadFromStream(PhobosStreamReader& Stm) override;
@@ -82,8 +124,17 @@ public:
 		void Serialize(T& Stm);
 	};
 
+	static ExtData* GetResolvedData(TEventClass* pThis);
+	static HouseClass* ResolveHouse(int index);
+	static void MarkForEvaluation(TEventClass* pThis);
+	static void Publish(PhobosTriggerInput input);
+
+	static void Clear();
+	static void PointerGotInvalid(void* ptr, bool removed);
+
 	static bool Execute(TEventClass* pThis, int iEvent, HouseClass* pHouse, ObjectClass* pObject,
 					CDTimerClass* pTimer, bool* isPersitant, TechnoClass* pSource, bool& bHandled);
+	static bool Evaluate(TEventClass* pThis, HouseClass* pHouse, ObjectClass* pObject, bool& bHandled);
 
 	template<bool IsGlobal, typename _Pr>
 	static bool VariableCheck(TEventClass* pThis);
@@ -105,4 +156,9 @@ public:
 	};
 
 	static ExtContainer ExtMap;
+
+private:
+	// TEventClass has no extension hooks, data is allocated on first evaluation and tracked here to be freed.
+	static std::vector<TEventClass*> ResolvedEvents;
+	static int InputGenerations[static_cast<int>(PhobosTriggerInput::Count)];
 };
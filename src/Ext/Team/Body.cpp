@@ -1,5 +1,10 @@
 #include "Body.h"
 
+#include <AircraftClass.h>
+#include <InfantryClass.h>
+
+#include <Ext/Script/Body.h>
+
 TeamExt::ExtContainer TeamExt::ExtMap;
 
 // =============================
@@ -39,9 +44,91 @@ void TeamExt::ExtData::SaveToStream(PhobosStreamWriter& Stm)
 
 void TeamExt::ExtData::InvalidatePointer(void* ptr, bool bRemoved)
 {
+	// A member may have gone away, don't hand out a stale summary this frame
+	auto const pFoot = abstract_cast<FootClass*>(static_cast<AbstractClass*>(ptr));
+
+	if (ptr == this->TeamLeader || ptr == this->Members.BestLeader || ptr == this->Members.FirstUnitReloading
+		|| (pFoot && pFoot->Team == this->OwnerObject()))
+	{
+		this->Members.Frame = -1;
+	}
+
 	AnnounceInvalidPointer(TeamLeader, ptr);
 }
 
+const TeamExt::ExtData::MemberSummary& TeamExt::ExtData::GetMemberSummary()
+{
+	auto& summary = this->Members;
+	const int currentFrame = Unsorted::CurrentFrame;
+
+	// Members can still enter transports or die later in the same frame
+	if (summary.Frame == currentFrame && (!summary.BestLeader || ScriptExt::IsUnitAvailable(summary.BestLeader, true)))
+		return summary;
+
+	summary.Frame = currentFrame;
+	summary.BestLeader = nullptr;
+	summary.FirstUnitReloading = nullptr;
+	summary.HasAircraftWithoutAmmo = false;
+	summary.IsPacifist = true;
+	summary.HasAgent = false;
+
+	int bestLeadershipRating = -1;
+
+	for (auto pUnit = this->OwnerObject()->FirstUnit; pUnit; pUnit = pUnit->NextTeamMember)
+	{
+		auto const pType = pUnit->GetTechnoType();
+
+		// Airport bound aircraft rearm at their dock and others only if they can reload themselves.
+		if (!summary.FirstUnitReloading && !pUnit->InLimbo && pUnit->Health > 0 && pType->Ammo > 0 && pUnit->Ammo < pType->Ammo)
+		{
+			if (pUnit->WhatAmI() == AbstractType::Aircraft ? static_cast<AircraftTypeClass*>(pType)->AirportBound : pType->Reload != 0)
+				summary.FirstUnitReloading = pUnit;
+		}
+
+		if (!ScriptExt::IsUnitAvailable(pUnit, true))
+			continue;
+
+		auto const whatAmI = pUnit->WhatAmI();
+
+		// The team Leader will be used for selecting targets, if there are living Team Members then always exists 1 Leader.
+		if ((pUnit->IsInitiated || whatAmI == AbstractType::Aircraft) && pType->LeadershipRating > bestLeadershipRating)
+		{
+			summary.BestLeader = pUnit;
+			bestLeadershipRating = pType->LeadershipRating;
+		}
+
+		if (whatAmI == AbstractType::Aircraft
+			&& !pUnit->IsInAir()
+			&& static_cast<AircraftTypeClass*>(pType)->AirportBound
+			&& pUnit->Ammo < pType->Ammo)
+		{
+			summary.HasAircraftWithoutAmmo = true;
+		}
+
+		summary.IsPacifist &= !ScriptExt::IsUnitArmed(pUnit);
+
+		if (whatAmI == AbstractType::Infantry)
+		{
+			auto const pTypeInf = static_cast<InfantryTypeClass*>(pType);
+
+			// Any Team member (infantry) is a special agent? If yes ignore some checks based on Weapons.
+			if ((pTypeInf->Agent && pTypeInf->Infiltrate) || pTypeInf->Engineer)
+				summary.HasAgent = true;
+		}
+	}
+
+	return summary;
+}
+
+// Keeps the current leader while it is available, otherwise promotes a new one.
+FootClass* TeamExt::ExtData::GetTeamLeader()
+{
+	if (!ScriptExt::IsUnitAvailable(this->TeamLeader, true))
+		this->TeamLeader = this->GetMemberSummary().BestLeader;
+
+	return this->TeamLeader;
+}
+
 // =============================
 // container
 
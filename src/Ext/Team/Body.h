@@ -33,6 +33,19 @@ public:
 		FootClass* TeamLeader;
 		std::vector<ScriptClass*> PreviousScriptList;
 
+		// Summary of the available team members shared by the script actions, rebuilt at most once per frame.
+		struct MemberSummary
+		{
+			int Frame;
+			FootClass* BestLeader;
+			FootClass* FirstUnitReloading; // First member that is still waiting for its ammo to refill.
+			bool HasAircraftWithoutAmmo;
+			bool IsPacifist;
+			bool HasAgent;
+		};
+
+		MemberSummary Members;
+
 		ExtData(TeamClass* OwnerObject) : Extension<TeamClass>(OwnerObject)
 			, WaitNoTargetAttempts { 0 }
 			, NextSuccessWeightAward { 0 }
@@ -47,8 +60,12 @@ public:
 			, ForceJump_RepeatMode { false }
 			, TeamLeader { nullptr }
 			, PreviousScriptList { }
+			, Members { -1, nullptr, nullptr, false, true, false }
 		{ }
 
+		const MemberSummary& GetMemberSummary();
+		FootClass* GetTeamLeader();
+
 		virtual ~ExtData() = default;
 
 		virtual void InvalidatePointer(void* ptr, bool bRemoved) override;
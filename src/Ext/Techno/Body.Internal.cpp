@@ -195,14 +195,25 @@ int TechnoExt::GetCustomTintIntensity(TechnoClass* pThis)
 // Applies custom tint color and intensity from TechnoTypes and any AttachEffects and shields it might have on provided values.
 void TechnoExt::ApplyCustomTintValues(TechnoClass* pThis, int& color, int& intensity)
 {
-	auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType());
 	auto const pExt = TechnoExt::ExtMap.Find(pThis);
-	bool hasTechnoTint = pTypeExt->Tint_Color.isset() || pTypeExt->Tint_Intensity;
-	bool hasShieldTint = pExt->Shield && pExt->Shield->IsActive() && pExt->Shield->GetType()->HasTint();
 
-	// Bail out early if no custom tint is applied.
-	if (!hasTechnoTint && !pExt->AE.HasTint && !hasShieldTint)
-		return;
+	// Visibility of the tints depends on the owner and current player, which are not tracked through state changes.
+	if (pExt->CustomTintOwner != pThis->Owner || pExt->CustomTintViewer != HouseClass::CurrentPlayer)
+		pExt->RecalculateCustomTint();
+
+	color |= pExt->CustomTintColor;
+	intensity += pExt->CustomTintIntensity;
+}
+
+// Recalculates combined custom tint from TechnoType, AttachEffects and shield. Returns true if the effective tint changed.
+bool TechnoExt::ExtData::RecalculateCustomTint()
+{
+	auto const pThis = this->OwnerObject();
+	auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType());
+	bool hasTechnoTint = pTypeExt->Tint_Color.isset() || pTypeExt->Tint_Intensity;
+	bool hasShieldTint = this->Shield && this->Shield->IsActive() && this->Shield->GetType()->HasTint();
+	int color = 0;
+	int intensity = 0;
 
 	if (hasTechnoTint && EnumFunctions::CanTargetHouse(pTypeExt->Tint_VisibleToHouses, pThis->Owner, HouseClass::CurrentPlayer))
 	{
@@ -210,29 +221,45 @@ void TechnoExt::ApplyCustomTintValues(TechnoClass* pThis, int& color, int& inten
 		intensity += static_cast<int>(pTypeExt->Tint_Intensity * 1000);
 	}
 
-	if (pExt->AE.HasTint)
+	// Not relying on AE.HasTint here as this can be called before stat multipliers are recalculated.
+	for (auto const& attachEffect : this->AttachedEffects)
 	{
-		for (auto const& attachEffect : pExt->AttachedEffects)
-		{
-			auto const type = attachEffect->GetType();
+		auto const type = attachEffect->GetType();
 
-			if (!attachEffect->IsActive() || !type->HasTint())
-				continue;
+		if (!attachEffect->IsActive() || !type->HasTint())
+			continue;
 
-			if (!EnumFunctions::CanTargetHouse(type->Tint_VisibleToHouses, pThis->Owner, HouseClass::CurrentPlayer))
-				continue;
+		if (!EnumFunctions::CanTargetHouse(type->Tint_VisibleToHouses, pThis->Owner, HouseClass::CurrentPlayer))
+			continue;
 
-			color |= Drawing::RGB_To_Int(type->Tint_Color);
-			intensity += static_cast<int>(type->Tint_Intensity * 1000);
-		}
+		color |= Drawing::RGB_To_Int(type->Tint_Color);
+		intensity += static_cast<int>(type->Tint_Intensity * 1000);
 	}
 
 	if (hasShieldTint)
 	{
-		auto const pShieldType = pExt->Shield->GetType();
+		auto const pShieldType = this->Shield->GetType();
 		color |= Drawing::RGB_To_Int(pShieldType->Tint_Color);
 		intensity += static_cast<int>(pShieldType->Tint_Intensity * 1000);
 	}
+
+	this->CustomTintOwner = pThis->Owner;
+	this->CustomTintViewer = HouseClass::CurrentPlayer;
+
+	if (color == this->CustomTintColor && intensity == this->CustomTintIntensity)
+		return false;
+
+	this->CustomTintColor = color;
+	this->CustomTintIntensity = intensity;
+
+	return true;
+}
+
+// Called whenever AttachEffect or shield state affecting tint changes, only redraws if the effective tint actually changed.
+void TechnoExt::ExtData::UpdateCustomTint()
+{
+	if (this->RecalculateCustomTint())
+		this->OwnerObject()->MarkForRedraw();
 }
 
 // This is still not even correct, but let's see how far this can help us
@@ -351,7 +351,10 @@ void TechnoExt::ExtData::UpdateShield()
 
 	// Create shield class instance if it does not exist.
 	if (this->CurrentShieldType && this->CurrentShieldType->Strength && !this->Shield)
+	{
 		this->Shield = std::make_unique<ShieldClass>(this->OwnerObject());
+		this->UpdateCustomTint();
+	}
 
 	if (const auto pShieldData = this->Shield.get())
 		pShieldData->AI();
@@ -819,9 +822,8 @@ void TechnoExt::ExtData::UpdateAttachEffects()
 {
 	auto const pThis = this->OwnerObject();
 	bool inTunnel = this->IsInTunnel || this->IsBurrowed;
-	bool markForRedraw = false;
+	bool tintChanged = false;
 	std::vector<std::unique_ptr<AttachEffectClass>>::iterator it;
-	std::vector<WeaponTypeClass*> expireWeapons;
 
 	for (it = this->AttachedEffects.begin(); it != this->AttachedEffects.end(); )
 	{
@@ -830,7 +832,12 @@ void TechnoExt::ExtData::UpdateAttachEffects()
 		if (!inTunnel)
 			attachEffect->SetAnimationTunnelState(true);
 
+		bool wasActive = attachEffect->IsActive();
 		attachEffect->AI();
+
+		if (wasActive != attachEffect->IsActive() && attachEffect->GetType()->HasTint())
+			tintChanged = true;
+
 		bool hasExpired = attachEffect->HasExpired();
 		bool shouldDiscard = attachEffect->IsActive() && attachEffect->ShouldBeDiscardedNow();
 
@@ -840,7 +847,7 @@ void TechnoExt::ExtData::UpdateAttachEffects()
 			attachEffect->ShouldBeDiscarded = false;
 
 			if (pType->HasTint())
-				markForRedraw = true;
+				tintChanged = true;
 
 			if (pType->Cumulative && pType->CumulativeAnimations.size() > 0)
 				this->UpdateCumulativeAttachEffects(attachEffect->GetType(), attachEffect);
@@ -849,7 +856,7 @@ void TechnoExt::ExtData::UpdateAttachEffects()
 				|| (shouldDiscard && (pType->ExpireWeapon_TriggerOn & ExpireWeaponCondition::Discard) != ExpireWeaponCondition::None)))
 			{
 				if (!pType->Cumulative || !pType->ExpireWeapon_CumulativeOnlyOnce || this->GetAttachedEffectCumulativeCount(pType) < 1)
-					expireWeapons.push_back(pType->ExpireWeapon);
+					WeaponTypeExt::QueueDetonation(pType->ExpireWeapon, pThis->GetCoords(), pThis, pThis->Owner, pThis);
 			}
 
 			if (shouldDiscard && attachEffect->ResetIfRecreatable())
@@ -868,16 +875,10 @@ void TechnoExt::ExtData::UpdateAttachEffects()
 
 	this->RecalculateStatMultipliers();
 
-	if (markForRedraw)
-		pThis->MarkForRedraw();
-
-	auto const coords = pThis->GetCoords();
-	auto const pOwner = pThis->Owner;
+	if (tintChanged)
+		this->UpdateCustomTint();
 
-	for (auto const& pWeapon : expireWeapons)
-	{
-		WeaponTypeExt::DetonateAt(pWeapon, coords, pThis, pOwner, pThis);
-	}
+	WeaponTypeExt::FlushDetonations();
 }
 
 // Updates self-owned (defined on TechnoType) AttachEffects, called on type conversion.
@@ -886,8 +887,6 @@ void TechnoExt::ExtData::UpdateSelfOwnedAttachEffects()
 	auto const pThis = this->OwnerObject();
 	auto const pTypeExt = this->TypeExtData;
 	std::vector<std::unique_ptr<AttachEffectClass>>::iterator it;
-	std::vector<WeaponTypeClass*> expireWeapons;
-	bool markForRedraw = false;
 
 	// Delete ones on old type and not on current.
 	for (it = this->AttachedEffects.begin(); it != this->AttachedEffects.end(); )
@@ -902,10 +901,9 @@ void TechnoExt::ExtData::UpdateSelfOwnedAttachEffects()
 			if (pType->ExpireWeapon && (pType->ExpireWeapon_TriggerOn & ExpireWeaponCondition::Expire) != ExpireWeaponCondition::None)
 			{
 				if (!pType->Cumulative || !pType->ExpireWeapon_CumulativeOnlyOnce || this->GetAttachedEffectCumulativeCount(pType) < 1)
-					expireWeapons.push_back(pType->ExpireWeapon);
+					WeaponTypeExt::QueueDetonation(pType->ExpireWeapon, pThis->GetCoords(), pThis, pThis->Owner, pThis);
 			}
 
-			markForRedraw |= pType->HasTint();
 			it = this->AttachedEffects.erase(it);
 		}
 		else
@@ -914,13 +912,7 @@ void TechnoExt::ExtData::UpdateSelfOwnedAttachEffects()
 		}
 	}
 
-	auto const coords = pThis->GetCoords();
-	auto const pOwner = pThis->Owner;
-
-	for (auto const& pWeapon : expireWeapons)
-	{
-		WeaponTypeExt::DetonateAt(pWeapon, coords, pThis, pOwner, pThis);
-	}
+	WeaponTypeExt::FlushDetonations();
 
 	// Add new ones.
 	int count = AttachEffectClass::Attach(pThis, pThis->Owner, pThis, pThis, pTypeExt->AttachEffects);
@@ -928,8 +920,8 @@ void TechnoExt::ExtData::UpdateSelfOwnedAttachEffects()
 	if (!count)
 		this->RecalculateStatMultipliers();
 
-	if (markForRedraw)
-		pThis->MarkForRedraw();
+	// TechnoType tint may have changed as well.
+	this->UpdateCustomTint();
 }
 
 // Updates CumulativeAnimations AE's on techno.
@@ -991,13 +983,19 @@ void TechnoExt::ExtData::RecalculateStatMultipliers()
 	bool reflectsDamage = false;
 	bool hasOnFireDiscardables = false;
 	bool hasRestrictedArmorMultipliers = false;
+	bool hasRevengeWeapon = false;
+	bool hasCritModifiers = false;
+	bool hasDeathExpireWeapon = false;
+	size_t rangeModifierSignature = 0;
 
 	for (const auto& attachEffect : this->AttachedEffects)
 	{
+		auto const type = attachEffect->GetType();
+		hasDeathExpireWeapon |= type->ExpireWeapon && (type->ExpireWeapon_TriggerOn & ExpireWeaponCondition::Death) != ExpireWeaponCondition::None;
+
 		if (!attachEffect->IsActive())
 			continue;
 
-		auto const type = attachEffect->GetType();
 		firepower *= type->FirepowerMultiplier;
 		speed *= type->SpeedMultiplier;
 		armor *= type->ArmorMultiplier;
@@ -1010,6 +1008,11 @@ void TechnoExt::ExtData::RecalculateStatMultipliers()
 		reflectsDamage |= type->ReflectDamage;
 		hasOnFireDiscardables |= (type->DiscardOn & DiscardCondition::Firing) != DiscardCondition::None;
 		hasRestrictedArmorMultipliers |= (type->ArmorMultiplier != 1.0 && (type->ArmorMultiplier_AllowWarheads.size() > 0 || type->ArmorMultiplier_DisallowWarheads.size() > 0));
+		hasRevengeWeapon |= type->RevengeWeapon.Get() != nullptr;
+		hasCritModifiers |= (type->Crit_Multiplier != 1.0 || type->Crit_ExtraChance != 0.0);
+
+		if (type->WeaponRange_Multiplier != 1.0 || type->WeaponRange_ExtraRange != 0.0)
+			rangeModifierSignature = rangeModifierSignature * 31 + reinterpret_cast<size_t>(type);
 	}
 
 	this->AE.FirepowerMultiplier = firepower;
@@ -1024,6 +1027,15 @@ void TechnoExt::ExtData::RecalculateStatMultipliers()
 	this->AE.ReflectDamage = reflectsDamage;
 	this->AE.HasOnFireDiscardables = hasOnFireDiscardables;
 	this->AE.HasRestrictedArmorMultipliers = hasRestrictedArmorMultipliers;
+	this->AE.HasRevengeWeapon = hasRevengeWeapon;
+	this->AE.HasCritModifiers = hasCritModifiers;
+	this->AE.HasDeathExpireWeapon = hasDeathExpireWeapon;
+
+	if (this->AE.RangeModifierSignature != rangeModifierSignature)
+	{
+		this->AE.RangeModifierSignature = rangeModifierSignature;
+		TechnoExt::InvalidateWeaponRanges();
+	}
 
 	if (forceDecloak && pThis->CloakState == CloakState::Cloaked)
 		pThis->Uncloak(true);
@@ -4,9 +4,16 @@
 #include <SpawnManagerClass.h>
 
 #include <Utilities/EnumFunctions.h>
+#include <Utilities/Profiler.h>
+
+DEFINE_PROFILE_SECTION(Profile_DrawSelfHealPips, "TechnoExt::DrawSelfHealPips");
+DEFINE_PROFILE_SECTION(Profile_DrawInsignia, "TechnoExt::DrawInsignia");
+DEFINE_PROFILE_SECTION(Profile_ProcessDigitalDisplays, "TechnoExt::ProcessDigitalDisplays");
 
 void TechnoExt::DrawSelfHealPips(TechnoClass* pThis, Point2D* pLocation, RectangleStruct* pBounds)
 {
+	PROFILE_SCOPE(Profile_DrawSelfHealPips);
+
 	if (!RulesExt::Global()->GainSelfHealAllowMultiplayPassive && pThis->Owner->Type->MultiplayPassive)
 		return;
 
@@ -93,6 +100,8 @@ void TechnoExt::DrawSelfHealPips(TechnoClass* pThis, Point2D* pLocation, Rectang
 
 void TechnoExt::DrawInsignia(TechnoClass* pThis, Point2D* pLocation, RectangleStruct* pBounds)
 {
+	PROFILE_SCOPE(Profile_DrawInsignia);
+
 	Point2D offset = *pLocation;
 
 	SHPStruct* pShapeFile = FileSystem::PIPS_SHP;
@@ -273,6 +282,8 @@ Point2D TechnoExt::GetBuildingSelectBracketPosition(TechnoClass* pThis, Building
 
 void TechnoExt::ProcessDigitalDisplays(TechnoClass* pThis)
 {
+	PROFILE_SCOPE(Profile_ProcessDigitalDisplays);
+
 	if (!Phobos::Config::DigitalDisplay_Enable)
 		return;
 
@@ -7,6 +7,8 @@
 #include <Ext/Anim/Body.h>
 #include <Ext/Scenario/Body.h>
 #include <Ext/WeaponType/Body.h>
+#include <Ext/WarheadType/Body.h>
+#include <Ext/TEvent/Body.h>
 
 #include <Utilities/AresFunctions.h>
 
@@ -32,6 +34,9 @@ TechnoExt::ExtData::~ExtData()
 	}
 
 	AnimExt::InvalidateTechnoPointers(pThis);
+	TechnoExt::ClearReachableCellCache();
+	this->RemoveFromTechnoGrid();
+	WarheadTypeExt::ClearCellSpreadBatches();
 }
 
 bool TechnoExt::IsActive(TechnoClass* pThis)
@@ -46,6 +51,9 @@ bool TechnoExt::IsActive(TechnoClass* pThis)
 		;
 }
 
+DEFINE_PROFILE_SECTION(Profile_Memo_MovementZone_Hit, "Memo_MovementZone_Hit");
+DEFINE_PROFILE_SECTION(Profile_Memo_MovementZone_Miss, "Memo_MovementZone_Miss");
+
 bool TechnoExt::IsHarvesting(TechnoClass* pThis)
 {
 	if (!TechnoExt::IsActive(pThis))
@@ -164,6 +172,223 @@ CoordStruct TechnoExt::PassengerKickOutLocation(TechnoClass* pThis, FootClass* p
 	return finalLocation;
 }
 
+// The same target is usually checked by many attackers in a frame, all asking for the zone of its cell.
+int TechnoExt::GetMovementZone(TechnoClass* pThis, MovementZone mZone)
+{
+	auto const compute = [pThis, mZone]() { return MapClass::Instance->GetMovementZoneType(pThis->GetMapCoords(), mZone, pThis->OnBridge); };
+	auto const pExt = TechnoExt::ExtMap.Find(pThis);
+
+	if (!pExt)
+		return compute();
+
+	return pExt->MovementZoneMemo.Get(mZone, compute, Profile_Memo_MovementZone_Hit, Profile_Memo_MovementZone_Miss);
+}
+
+DEFINE_PROFILE_SECTION(Profile_ReachableCell_Hit, "Memo_ReachableCell_Hit");
+DEFINE_PROFILE_SECTION(Profile_ReachableCell_Miss, "Memo_ReachableCell_Miss");
+
+// Keyed by target, speed type and movement zone, dropped when the frame changes or a techno is destroyed.
+static std::unordered_map<unsigned __int64, double> ReachableCellDistances;
+static int ReachableCellDistancesFrame = -1;
+
+void TechnoExt::ClearReachableCellCache()
+{
+	ReachableCellDistances.clear();
+}
+
+// Distance from the target to the closest cell the given movement can reach next to it, -1 if there is none.
+// It does not depend on the searcher's own zone, so every searcher of the same movement type shares it.
+double TechnoExt::GetReachableCellDistance(TechnoClass* pTarget, SpeedType speedType, MovementZone mZone)
+{
+	const int currentFrame = Unsorted::CurrentFrame;
+
+	if (ReachableCellDistancesFrame != currentFrame)
+	{
+		ReachableCellDistances.clear();
+		ReachableCellDistancesFrame = currentFrame;
+	}
+
+	const unsigned __int64 key = (static_cast<unsigned __int64>(reinterpret_cast<uintptr_t>(pTarget)) << 16)
+		| (static_cast<unsigned __int64>(static_cast<unsigned char>(speedType)) << 8)
+		| static_cast<unsigned char>(mZone);
+
+	auto const it = ReachableCellDistances.find(key);
+
+	if (it != ReachableCellDistances.end())
+	{
+		PROFILE_COUNT(Profile_ReachableCell_Hit);
+		return it->second;
+	}
+
+	PROFILE_COUNT(Profile_ReachableCell_Miss);
+
+	auto cellStruct = MapClass::Instance->NearByLocation(CellClass::Coord2Cell(pTarget->Location),
+		speedType, -1, mZone, false, 1, 1, true,
+		false, false, speedType != SpeedType::Float, CellStruct::Empty, false, false);
+	auto const pCell = MapClass::Instance->GetCellAt(cellStruct);
+	const double distance = pCell ? pCell->GetCoordsWithBridge().DistanceFrom(pTarget->GetCenterCoords()) : -1.0;
+
+	ReachableCellDistances.emplace(key, distance);
+	return distance;
+}
+
+// Technos bucketed by map area. Each techno remembers its bucket, so destroyed technos are taken out of their own
+// bucket and technos are only moved when the first query of a frame finds their bucket changed. Technos placed on
+// the map later in the frame are queued and validated by the next query; other movement within the frame is covered
+// by padding every query with TechnoGridMargin.
+static constexpr int TechnoGridBucketCells = 8;
+static constexpr int TechnoGridMargin = 2 * Unsorted::LeptonsPerCell;
+static std::unordered_map<int, std::vector<TechnoClass*>> TechnoGridBuckets;
+static std::vector<TechnoClass*> TechnoGridPending;
+static int TechnoGridFrame = -1;
+
+static int TechnoGridBucketKey(int bucketX, int bucketY)
+{
+	return (bucketX << 16) | (bucketY & 0xFFFF);
+}
+
+static int TechnoGridBucketKey(const CellStruct& cell)
+{
+	return TechnoGridBucketKey(cell.X / TechnoGridBucketCells, cell.Y / TechnoGridBucketCells);
+}
+
+static void TechnoGridEraseFromBucket(TechnoClass* pTechno, int key)
+{
+	auto& bucket = TechnoGridBuckets[key];
+	auto const it = std::find(bucket.begin(), bucket.end(), pTechno);
+
+	if (it != bucket.end())
+	{
+		*it = bucket.back();
+		bucket.pop_back();
+	}
+}
+
+void TechnoExt::ExtData::UpdateTechnoGrid()
+{
+	const int key = TechnoGridBucketKey(CellClass::Coord2Cell(this->OwnerObject()->GetCoords()));
+
+	if (this->InTechnoGrid)
+	{
+		if (this->TechnoGridKey == key)
+			return;
+
+		TechnoGridEraseFromBucket(this->OwnerObject(), this->TechnoGridKey);
+	}
+
+	TechnoGridBuckets[key].push_back(this->OwnerObject());
+	this->TechnoGridKey = key;
+	this->InTechnoGrid = true;
+}
+
+void TechnoExt::ExtData::RemoveFromTechnoGrid()
+{
+	auto const pThis = this->OwnerObject();
+
+	if (this->InTechnoGrid)
+	{
+		TechnoGridEraseFromBucket(pThis, this->TechnoGridKey);
+		this->InTechnoGrid = false;
+	}
+
+	TechnoGridPending.erase(std::remove(TechnoGridPending.begin(), TechnoGridPending.end(), pThis), TechnoGridPending.end());
+}
+
+void TechnoExt::QueueTechnoGridUpdate(TechnoClass* pThis)
+{
+	TechnoGridPending.push_back(pThis);
+}
+
+// Technos that may be within range of coords, in TechnoClass::Array order. Callers still have to check the distance.
+void TechnoExt::GetTechnosNear(std::vector<TechnoClass*>& result, const CoordStruct& coords, int range)
+{
+	result.clear();
+	const int currentFrame = Unsorted::CurrentFrame;
+
+	if (TechnoGridFrame != currentFrame)
+	{
+		for (auto const pTechno : *TechnoClass::Array)
+			TechnoExt::ExtMap.Find(pTechno)->UpdateTechnoGrid();
+
+		TechnoGridPending.clear();
+		TechnoGridFrame = currentFrame;
+	}
+	else if (!TechnoGridPending.empty())
+	{
+		for (auto const pTechno : TechnoGridPending)
+			TechnoExt::ExtMap.Find(pTechno)->UpdateTechnoGrid();
+
+		TechnoGridPending.clear();
+	}
+
+	const int cellRange = (Math::max(range, 0) + TechnoGridMargin) / Unsorted::LeptonsPerCell + 1;
+	auto const cell = CellClass::Coord2Cell(coords);
+	const int minX = (cell.X - cellRange) / TechnoGridBucketCells;
+	const int maxX = (cell.X + cellRange) / TechnoGridBucketCells;
+	const int minY = (cell.Y - cellRange) / TechnoGridBucketCells;
+	const int maxY = (cell.Y + cellRange) / TechnoGridBucketCells;
+
+	for (int x = minX; x <= maxX; x++)
+	{
+		for (int y = minY; y <= maxY; y++)
+		{
+			auto const it = TechnoGridBuckets.find(TechnoGridBucketKey(x, y));
+
+			if (it != TechnoGridBuckets.end())
+				result.insert(result.end(), it->second.begin(), it->second.end());
+		}
+	}
+
+	// Unique IDs are handed out in creation order, which is also the order of TechnoClass::Array
+	std::sort(result.begin(), result.end(),
+		[](TechnoClass* pA, TechnoClass* pB) { return pA->UniqueID < pB->UniqueID; });
+}
+
+DEFINE_PROFILE_SECTION(Profile_WeaponRange_Hit, "Memo_WeaponRange_Hit");
+DEFINE_PROFILE_SECTION(Profile_WeaponRange_Miss, "Memo_WeaponRange_Miss");
+
+// Bumped whenever any techno's set of active weapon range modifiers changes. Passengers can use their
+// transport's modifiers, so a single counter is simpler than tracking who depends on whom.
+static int WeaponRangeVersion = 0;
+
+void TechnoExt::InvalidateWeaponRanges()
+{
+	++WeaponRangeVersion;
+}
+
+// WeaponTypeExt::GetRangeWithModifiers for the techno firing the weapon, cached until range modifiers change.
+// Veterancy and passenger changes select different weapons or technos and so miss the cache on their own.
+int TechnoExt::GetWeaponRange(TechnoClass* pThis, WeaponTypeClass* pWeapon)
+{
+	auto const pExt = TechnoExt::ExtMap.Find(pThis);
+	auto const pTransporter = pThis->Transporter;
+	const bool canOccupyFire = pThis->CanOccupyFire();
+
+	for (auto& entry : pExt->WeaponRangeCache)
+	{
+		if (entry.Weapon != pWeapon)
+			continue;
+
+		if (entry.Version == WeaponRangeVersion && entry.Transporter == pTransporter && entry.CanOccupyFire == canOccupyFire)
+		{
+			PROFILE_COUNT(Profile_WeaponRange_Hit);
+			return entry.Range;
+		}
+
+		PROFILE_COUNT(Profile_WeaponRange_Miss);
+		entry.Transporter = pTransporter;
+		entry.CanOccupyFire = canOccupyFire;
+		entry.Version = WeaponRangeVersion;
+		entry.Range = WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis);
+		return entry.Range;
+	}
+
+	PROFILE_COUNT(Profile_WeaponRange_Miss);
+	const int range = WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis);
+	pExt->WeaponRangeCache.push_back({ pWeapon, pTransporter, canOccupyFire, WeaponRangeVersion, range });
+	return range;
+}
+
 bool TechnoExt::AllowedTargetByZone(TechnoClass* pThis, TechnoClass* pTarget, TargetZoneScanType zoneScanType, WeaponTypeClass* pWeapon, bool useZone, int zone)
 {
 	if (!pThis || !pTarget)
@@ -173,14 +398,14 @@ bool TechnoExt::AllowedTargetByZone(TechnoClass* pThis, TechnoClass* pTarget, Ta
 		return true;
 
 	MovementZone mZone = pThis->GetTechnoType()->MovementZone;
-	int currentZone = useZone ? zone : MapClass::Instance->GetMovementZoneType(pThis->GetMapCoords(), mZone, pThis->OnBridge);
+	int currentZone = useZone ? zone : TechnoExt::GetMovementZone(pThis, mZone);
 
 	if (currentZone != -1)
 	{
 		if (zoneScanType == TargetZoneScanType::Any)
 			return true;
 
-		int targetZone = MapClass::Instance->GetMovementZoneType(pTarget->GetMapCoords(), mZone, pTarget->OnBridge);
+		int targetZone = TechnoExt::GetMovementZone(pTarget, mZone);
 
 		if (zoneScanType == TargetZoneScanType::Same)
 		{
@@ -192,17 +417,11 @@ bool TechnoExt::AllowedTargetByZone(TechnoClass* pThis, TechnoClass* pTarget, Ta
 			if (currentZone == targetZone)
 				return true;
 
-			auto const speedType = pThis->GetTechnoType()->SpeedType;
-			auto cellStruct = MapClass::Instance->NearByLocation(CellClass::Coord2Cell(pTarget->Location),
-				speedType, -1, mZone, false, 1, 1, true,
-				false, false, speedType != SpeedType::Float, CellStruct::Empty, false, false);
-			auto const pCell = MapClass::Instance->GetCellAt(cellStruct);
+			const double distance = TechnoExt::GetReachableCellDistance(pTarget, pThis->GetTechnoType()->SpeedType, mZone);
 
-			if (!pCell)
+			if (distance < 0)
 				return false;
 
-			double distance = pCell->GetCoordsWithBridge().DistanceFrom(pTarget->GetCenterCoords());
-
 			if (!pWeapon)
 			{
 				int weaponIndex = pThis->SelectWeapon(pTarget);
@@ -284,6 +503,7 @@ bool TechnoExt::ConvertToType(FootClass* pThis, TechnoTypeClass* pToType)
 	if (!pThis->InLimbo)
 		pOwner->RegisterGain(pThis, false);
 	pOwner->RecheckTechTree = true;
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
 
 	// Update Ares AttachEffects -- skipped
 	// Ares RecalculateStats -- skipped
@@ -381,7 +601,7 @@ bool TechnoExt::IsTypeImmune(TechnoClass* pThis, TechnoClass* pSource)
 /// <param name="pInvoker">Invoker Techno used for same source check.</param>
 /// <param name="pSource">Source AbstractClass instance used for same source check.</param>
 /// <returns>True if techno has active AttachEffects that satisfy the source, false if not.</returns>
-bool TechnoExt::ExtData::HasAttachedEffects(std::vector<AttachEffectTypeClass*> attachEffectTypes, bool requireAll, bool ignoreSameSource,
+bool TechnoExt::ExtData::HasAttachedEffects(const std::vector<AttachEffectTypeClass*>& attachEffectTypes, bool requireAll, bool ignoreSameSource,
 	TechnoClass* pInvoker, AbstractClass* pSource, std::vector<int> const* minCounts, std::vector<int> const* maxCounts) const
 {
 	unsigned int foundCount = 0;
@@ -554,6 +774,8 @@ DEFINE_HOOK(0x6F4500, TechnoClass_DTOR, 0x5)
 	GET(TechnoClass*, pItem, ECX);
 
 	TechnoExt::ExtMap.Remove(pItem);
+	TEventExt::Publish(PhobosTriggerInput::TechnoOwnership);
+	TEventExt::Publish(PhobosTriggerInput::ShieldState);
 
 	return 0;
 }
@@ -6,6 +6,7 @@
 #include <Utilities/Container.h>
 #include <Utilities/TemplateDef.h>
 #include <Utilities/Macro.h>
+#include <Utilities/FrameMemo.h>
 #include <New/Entity/ShieldClass.h>
 #include <New/Entity/LaserTrailClass.h>
 #include <New/Entity/AttachEffectClass.h>
@@ -59,6 +60,32 @@ public:
 		int LastWarpInDelay;                   // Last-warp in delay for this unit, used by HasCarryoverWarpInDelay.
 		bool IsBeingChronoSphered;             // Set to true on units currently being ChronoSphered, does not apply to Ares-ChronoSphere'd buildings or Chrono reinforcements.
 
+		// Combined custom tint from TechnoType, AttachEffects and shield, recalculated only when one of those changes.
+		// Owner and viewing house it was calculated for are only compared against, so no need to serialize any of these.
+		int CustomTintColor;
+		int CustomTintIntensity;
+		HouseClass* CustomTintOwner;
+		HouseClass* CustomTintViewer;
+
+		// Predicates queried by several systems per frame, see FrameMemo.
+		FrameMemo<int, MovementZone> MovementZoneMemo;
+
+		// Weapon ranges with AttachEffect modifiers applied, see TechnoExt::GetWeaponRange.
+		struct WeaponRangeCacheEntry
+		{
+			WeaponTypeClass* Weapon;
+			TechnoClass* Transporter;
+			bool CanOccupyFire;
+			int Version;
+			int Range;
+		};
+
+		std::vector<WeaponRangeCacheEntry> WeaponRangeCache;
+
+		// Bucket this techno is filed under, see TechnoExt::GetTechnosNear. Rebuilt after loading, so not serialized.
+		int TechnoGridKey;
+		bool InTechnoGrid;
+
 		ExtData(TechnoClass* OwnerObject) : Extension<TechnoClass>(OwnerObject)
 			, TypeExtData { nullptr }
 			, Shield {}
@@ -92,6 +119,14 @@ public:
 			, HasRemainingWarpInDelay { false }
 			, LastWarpInDelay { 0 }
 			, IsBeingChronoSphered { false }
+			, CustomTintColor { 0 }
+			, CustomTintIntensity { 0 }
+			, CustomTintOwner { nullptr }
+			, CustomTintViewer { nullptr }
+			, MovementZoneMemo {}
+			, WeaponRangeCache {}
+			, TechnoGridKey { 0 }
+			, InTechnoGrid { false }
 		{ }
 
 		void OnEarlyUpdate();
@@ -108,12 +143,16 @@ public:
 		void UpdateAttachEffects();
 		void UpdateCumulativeAttachEffects(AttachEffectTypeClass* pAttachEffectType, AttachEffectClass* pRemoved = nullptr);
 		void RecalculateStatMultipliers();
+		bool RecalculateCustomTint();
+		void UpdateCustomTint();
+		void UpdateTechnoGrid();
+		void RemoveFromTechnoGrid();
 		void UpdateTemporal();
 		void UpdateMindControlAnim();
 		void InitializeLaserTrails();
 		void InitializeAttachEffects();
 		void UpdateSelfOwnedAttachEffects();
-		bool HasAttachedEffects(std::vector<AttachEffectTypeClass*> attachEffectTypes, bool requireAll, bool ignoreSameSource, TechnoClass* pInvoker, AbstractClass* pSource, std::vector<int> const* minCounts, std::vector<int> const* maxCounts) const;
+		bool HasAttachedEffects(const std::vector<AttachEffectTypeClass*>& attachEffectTypes, bool requireAll, bool ignoreSameSource, TechnoClass* pInvoker, AbstractClass* pSource, std::vector<int> const* minCounts, std::vector<int> const* maxCounts) const;
 		int GetAttachedEffectCumulativeCount(AttachEffectTypeClass* pAttachEffectType, bool ignoreSameSource = false, TechnoClass* pInvoker = nullptr, AbstractClass* pSource = nullptr) const;
 
 		virtual ~ExtData() override;
@@ -141,6 +180,13 @@ public:
 	static bool IsActive(TechnoClass* pThis);
 
 	static bool IsHarvesting(TechnoClass* pThis);
+	static int GetMovementZone(TechnoClass* pThis, MovementZone mZone);
+	static double GetReachableCellDistance(TechnoClass* pTarget, SpeedType speedType, MovementZone mZone);
+	static void ClearReachableCellCache();
+	static int GetWeaponRange(TechnoClass* pThis, WeaponTypeClass* pWeapon);
+	static void InvalidateWeaponRanges();
+	static void GetTechnosNear(std::vector<TechnoClass*>& result, const CoordStruct& coords, int range);
+	static void QueueTechnoGridUpdate(TechnoClass* pThis);
 	static bool HasAvailableDock(TechnoClass* pThis);
 
 	static CoordStruct GetFLHAbsoluteCoords(TechnoClass* pThis, CoordStruct flh, bool turretFLH = false);
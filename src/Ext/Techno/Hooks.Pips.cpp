@@ -3,6 +3,12 @@
 #include <TiberiumClass.h>
 #include "Body.h"
 
+#include <Utilities/Profiler.h>
+
+DEFINE_PROFILE_SECTION(Profile_DrawPips_Spawns, "TechnoClass_DrawPips_Spawns");
+DEFINE_PROFILE_SECTION(Profile_DrawPips_Ammo, "TechnoClass_DrawPips_Ammo");
+DEFINE_PROFILE_SECTION(Profile_DrawPips_Tiberium, "TechnoClass_DrawPips_Tiberium");
+
 DEFINE_HOOK(0x6F64A9, TechnoClass_DrawHealthBar_Hide, 0x5)
 {
 	GET(TechnoClass*, pThis, ECX);
@@ -81,25 +87,10 @@ DEFINE_HOOK(0x709B2E, TechnoClass_DrawPips_Sizes, 0x5)
 	GET(TechnoClass*, pThis, ECX);
 	REF_STACK(int, pipWidth, STACK_OFFSET(0x74, -0x1C));
 
-	Point2D size;
-	bool isBuilding = pThis->WhatAmI() == AbstractType::Building;
-
-	if (pThis->GetTechnoType()->PipScale == PipScale::Ammo)
-	{
-		if (isBuilding)
-			size = RulesExt::Global()->Pips_Ammo_Buildings_Size;
-		else
-			size = RulesExt::Global()->Pips_Ammo_Size;
-
-		size = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType())->AmmoPipSize.Get(size);
-	}
-	else
-	{
-		if (isBuilding)
-			size = RulesExt::Global()->Pips_Generic_Buildings_Size;
-		else
-			size = RulesExt::Global()->Pips_Generic_Size;
-	}
+	auto const pType = pThis->GetTechnoType();
+	auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pType);
+	pTypeExt->ResolvePipLayout();
+	const Point2D& size = pType->PipScale == PipScale::Ammo ? pTypeExt->PipLayout_AmmoSize : pTypeExt->PipLayout_GenericSize;
 
 	pipWidth = size.X;
 	R->ESI(size.Y);
@@ -111,6 +102,8 @@ DEFINE_HOOK(0x709B8B, TechnoClass_DrawPips_Spawns, 0x5)
 {
 	enum { SkipGameDrawing = 0x709C27 };
 
+	PROFILE_SCOPE(Profile_DrawPips_Spawns);
+
 	GET(TechnoClass*, pThis, ECX);
 	auto const pTypeExt = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType());
 
@@ -120,18 +113,13 @@ DEFINE_HOOK(0x709B8B, TechnoClass_DrawPips_Spawns, 0x5)
 	LEA_STACK(RectangleStruct*, offset, STACK_OFFSET(0x74, -0x24));
 	GET_STACK(RectangleStruct*, rect, STACK_OFFSET(0x74, 0xC));
 	GET_STACK(SHPStruct*, shape, STACK_OFFSET(0x74, -0x58));
-	GET_STACK(bool, isBuilding, STACK_OFFSET(0x74, -0x61));
 	GET(int, maxSpawnsCount, EBX);
 
 	int currentSpawnsCount = pThis->SpawnManager->CountDockedSpawns();
 	auto const pipOffset = pTypeExt->SpawnsPipOffset.Get();
 	Point2D position = { offset->X + pipOffset.X, offset->Y + pipOffset.Y };
-	Point2D size;
-
-	if (isBuilding)
-		size = pTypeExt->SpawnsPipSize.Get(RulesExt::Global()->Pips_Generic_Buildings_Size);
-	else
-		size = pTypeExt->SpawnsPipSize.Get(RulesExt::Global()->Pips_Generic_Size);
+	pTypeExt->ResolvePipLayout();
+	const Point2D& size = pTypeExt->PipLayout_SpawnsSize;
 
 	for (int i = 0; i < maxSpawnsCount; i++)
 	{
@@ -151,6 +139,8 @@ DEFINE_HOOK(0x70A36E, TechnoClass_DrawPips_Ammo, 0x6)
 {
 	enum { SkipGameDrawing = 0x70A4EC };
 
+	PROFILE_SCOPE(Profile_DrawPips_Ammo);
+
 	GET(TechnoClass*, pThis, ECX);
 	LEA_STACK(RectangleStruct*, offset, STACK_OFFSET(0x74, -0x24));
 	GET_STACK(RectangleStruct*, rect, STACK_OFFSET(0x74, 0xC));
@@ -227,6 +217,8 @@ DEFINE_HOOK(0x70A1F6, TechnoClass_DrawPips_Tiberium, 0x6)
 {
 	enum { SkipGameDrawing = 0x70A4EC };
 
+	PROFILE_SCOPE(Profile_DrawPips_Tiberium);
+
 	GET(TechnoClass*, pThis, ECX);
 	LEA_STACK(RectangleStruct*, offset, STACK_OFFSET(0x74, -0x24));
 	GET_STACK(RectangleStruct*, rect, STACK_OFFSET(0x74, 0xC));
@@ -236,8 +228,17 @@ DEFINE_HOOK(0x70A1F6, TechnoClass_DrawPips_Tiberium, 0x6)
 
 	Point2D position = { offset->X, offset->Y };
 	const int totalStorage = pThis->GetTechnoType()->Storage;
+	auto const pRulesExt = RulesExt::Global();
 
-	std::vector<int> pipsToDraw;
+	auto drawPip = [&](int frame)
+	{
+		DSurface::Temp->DrawSHP(FileSystem::PALETTE_PAL, shape, frame,
+			&position, rect, BlitterFlags::Centered | BlitterFlags::bf_400, 0, 0,
+			ZGradient::Ground, 1000, 0, nullptr, 0, 0, 0);
+
+		position.X += offset->Width;
+		position.Y += yOffset;
+	};
 
 	bool isWeeder = false;
 
@@ -260,79 +261,47 @@ DEFINE_HOOK(0x70A1F6, TechnoClass_DrawPips_Tiberium, 0x6)
 			static_cast<int>(pThis->Tiberium.GetTotalAmount() / totalStorage * maxPips + 0.5);
 
 		for (int i = 0; i < maxPips; i++)
-		{
-			if (i < fullWeedFrames)
-				pipsToDraw.push_back(RulesExt::Global()->Pips_Tiberiums_WeedFrame);
-			else
-				pipsToDraw.push_back(RulesExt::Global()->Pips_Tiberiums_WeedEmptyFrame);
-		}
+			drawPip(i < fullWeedFrames ? pRulesExt->Pips_Tiberiums_WeedFrame : pRulesExt->Pips_Tiberiums_WeedEmptyFrame);
 	}
 	else
 	{
-		std::vector<int> tiberiumPipCounts(TiberiumClass::Array->Count);
+		// Reused between draws, the display order itself is resolved on rules load.
+		static std::vector<int> tiberiumPipCounts;
+		tiberiumPipCounts.assign(TiberiumClass::Array->Count, 0);
 
 		for (size_t i = 0; i < tiberiumPipCounts.size(); i++)
 		{
 			tiberiumPipCounts[i] = static_cast<int>(pThis->Tiberium.GetAmount(i) / totalStorage * maxPips + 0.5);
 		}
 
-		auto const rawPipOrder = RulesExt::Global()->Pips_Tiberiums_DisplayOrder.empty() ? std::vector<int>{ 0, 2, 3, 1 } : RulesExt::Global()->Pips_Tiberiums_DisplayOrder;
-		auto const& pipFrames = RulesExt::Global()->Pips_Tiberiums_Frames;
-		int const emptyFrame = RulesExt::Global()->Pips_Tiberiums_EmptyFrame;
-
-		std::vector<int> pipOrder;
-
-		// First make a new vector, removing all the duplicate and invalid tiberiums
-		for (int index : rawPipOrder)
-		{
-			if (std::find(pipOrder.begin(), pipOrder.end(), index) == pipOrder.end() &&
-				index >= 0 && index < TiberiumClass::Array->Count)
-			{
-				pipOrder.push_back(index);
-			}
-		}
-
-		// Then add any tiberium types that are missing
-		for (int i = 0; i < TiberiumClass::Array->Count; i++)
-		{
-			if (std::find(pipOrder.begin(), pipOrder.end(), i) == pipOrder.end())
-			{
-				pipOrder.push_back(i);
-			}
-		}
+		pRulesExt->ResolveTiberiumPipOrder();
+		auto const& pipOrder = pRulesExt->Pips_Tiberiums_ResolvedOrder;
+		auto const& pipFrames = pRulesExt->Pips_Tiberiums_Frames;
+		int const emptyFrame = pRulesExt->Pips_Tiberiums_EmptyFrame;
 
 		for (int i = 0; i < maxPips; i++)
 		{
+			int frame = emptyFrame;
+
 			for (const int index : pipOrder)
 			{
-				if (tiberiumPipCounts[index] > 0)
+				if (static_cast<size_t>(index) < tiberiumPipCounts.size() && tiberiumPipCounts[index] > 0)
 				{
 					tiberiumPipCounts[index]--;
 
 					if (static_cast<size_t>(index) >= pipFrames.size())
-						pipsToDraw.push_back(index == 1 ? 5 : 2);
+						frame = index == 1 ? 5 : 2;
 					else
-						pipsToDraw.push_back(pipFrames.at(index));
+						frame = pipFrames.at(index);
 
 					break;
 				}
 			}
 
-			if (pipsToDraw.size() <= static_cast<size_t>(i))
-				pipsToDraw.push_back(emptyFrame);
+			drawPip(frame);
 		}
 	}
 
-	for (int pip : pipsToDraw)
-	{
-		DSurface::Temp->DrawSHP(FileSystem::PALETTE_PAL, shape, pip,
-			&position, rect, BlitterFlags::Centered | BlitterFlags::bf_400, 0, 0,
-			ZGradient::Ground, 1000, 0, nullptr, 0, 0, 0);
-
-		position.X += offset->Width;
-		position.Y += yOffset;
-	}
-
 	return SkipGameDrawing;
 }
 
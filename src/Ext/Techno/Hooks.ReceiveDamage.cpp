@@ -4,9 +4,71 @@
 #include <Ext/WeaponType/Body.h>
 #include <Ext/TEvent/Body.h>
 
+// Phobos logic a techno can have on ReceiveDamage, hooks for features it does not have exit early.
+enum class ReceiveDamageFeature : unsigned char
+{
+	None = 0x0,
+	RevengeWeapon = 0x1,
+	DeathExpireWeapon = 0x2,
+	ReflectDamage = 0x4,
+	ExplodesOverride = 0x8
+};
+
+MAKE_ENUM_FLAGS(ReceiveDamageFeature);
+
 namespace ReceiveDamageTemp
 {
 	bool SkipLowDamageCheck = false;
+
+	// Lookups shared by the hooks of one ReceiveDamage call. Resolved when the call starts and reused
+	// by the later hooks while techno and warhead still match, nested calls (reflected damage, revenge
+	// weapons) overwrite it and the outer call then resolves again. Hooks get a copy so a nested call
+	// can't change pointers they are still using.
+	struct Context
+	{
+		TechnoClass* Techno;
+		WarheadTypeClass* Warhead;
+		TechnoExt::ExtData* Ext;
+		WarheadTypeExt::ExtData* WHExt;
+		ReceiveDamageFeature Features;
+
+		bool Has(ReceiveDamageFeature feature) const
+		{
+			return (this->Features & feature) != ReceiveDamageFeature::None;
+		}
+	};
+
+	Context Current {};
+
+	Context Begin(TechnoClass* pThis, WarheadTypeClass* pWarhead)
+	{
+		auto const pExt = TechnoExt::ExtMap.Find(pThis);
+		auto const pTypeExt = pExt->TypeExtData;
+		auto features = ReceiveDamageFeature::None;
+
+		if (pExt->AE.HasRevengeWeapon || (pTypeExt && pTypeExt->RevengeWeapon))
+			features |= ReceiveDamageFeature::RevengeWeapon;
+
+		if (pExt->AE.HasDeathExpireWeapon)
+			features |= ReceiveDamageFeature::DeathExpireWeapon;
+
+		if (pExt->AE.ReflectDamage)
+			features |= ReceiveDamageFeature::ReflectDamage;
+
+		if (pTypeExt && (!pTypeExt->Explodes_DuringBuildup || !pTypeExt->Explodes_KillPassengers))
+			features |= ReceiveDamageFeature::ExplodesOverride;
+
+		Current = { pThis, pWarhead, pExt, WarheadTypeExt::ExtMap.Find(pWarhead), features };
+		return Current;
+	}
+
+	Context Get(TechnoClass* pThis, WarheadTypeClass* pWarhead)
+	{
+		if (Current.Techno == pThis && Current.Warhead == pWarhead)
+			return Current;
+
+		return Begin(pThis, pWarhead);
+	}
 }
 
 // #issue 88 : shield logic
@@ -15,7 +77,7 @@ DEFINE_HOOK(0x701900, TechnoClass_ReceiveDamage_Shield, 0x6)
 	GET(TechnoClass*, pThis, ECX);
 	LEA_STACK(args_ReceiveDamage*, args, 0x4);
 
-	const auto pExt = TechnoExt::ExtMap.Find(pThis);
+	const auto pExt = ReceiveDamageTemp::Begin(pThis, args->WH).Ext;
 
 	int nDamageLeft = *args->Damage;
 
@@ -66,7 +128,7 @@ DEFINE_HOOK(0x702819, TechnoClass_ReceiveDamage_Decloak, 0xA)
 	GET(TechnoClass* const, pThis, ESI);
 	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
 
-	if (auto pExt = WarheadTypeExt::ExtMap.Find(pWarhead))
+	if (auto pExt = ReceiveDamageTemp::Get(pThis, pWarhead).WHExt)
 	{
 		if (pExt->DecloakDamagedTargets)
 			pThis->Uncloak(false);
@@ -79,9 +141,10 @@ DEFINE_HOOK(0x701DFF, TechnoClass_ReceiveDamage_FlyingStrings, 0x7)
 {
 	GET(TechnoClass* const, pThis, ESI);
 	GET(int* const, pDamage, EBX);
+	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
 
 	if (Phobos::DisplayDamageNumbers && *pDamage)
-		GeneralUtils::DisplayDamageNumberString(*pDamage, DamageDisplayType::Regular, pThis->GetRenderCoords(), TechnoExt::ExtMap.Find(pThis)->DamageNumberOffset);
+		GeneralUtils::DisplayDamageNumberString(*pDamage, DamageDisplayType::Regular, pThis->GetRenderCoords(), ReceiveDamageTemp::Get(pThis, pWarhead).Ext->DamageNumberOffset);
 
 	return 0;
 }
@@ -91,8 +154,14 @@ DEFINE_HOOK(0x702603, TechnoClass_ReceiveDamage_Explodes, 0x6)
 	enum { SkipExploding = 0x702672, SkipKillingPassengers = 0x702669 };
 
 	GET(TechnoClass*, pThis, ESI);
+	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
+
+	auto const context = ReceiveDamageTemp::Get(pThis, pWarhead);
+
+	if (!context.Has(ReceiveDamageFeature::ExplodesOverride))
+		return 0;
 
-	const auto pTypeExt = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType());
+	const auto pTypeExt = context.Ext->TypeExtData;
 
 	if (pThis->WhatAmI() == AbstractType::Building)
 	{
@@ -112,17 +181,22 @@ DEFINE_HOOK(0x702672, TechnoClass_ReceiveDamage_RevengeWeapon, 0x5)
 	GET_STACK(TechnoClass*, pSource, STACK_OFFSET(0xC4, 0x10));
 	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
 
-	if (pSource)
+	if (!pSource)
+		return 0;
+
+	auto const context = ReceiveDamageTemp::Get(pThis, pWarhead);
+
+	if (context.Has(ReceiveDamageFeature::RevengeWeapon))
 	{
-		auto const pExt = TechnoExt::ExtMap.Find(pThis);
+		auto const pExt = context.Ext;
 		auto const pTypeExt = pExt->TypeExtData;
-		auto const pWHExt = WarheadTypeExt::ExtMap.Find(pWarhead);
+		auto const pWHExt = context.WHExt;
 		bool hasFilters = pWHExt->SuppressRevengeWeapons_Types.size() > 0;
 
 		if (pTypeExt && pTypeExt->RevengeWeapon && EnumFunctions::CanTargetHouse(pTypeExt->RevengeWeapon_AffectsHouses, pThis->Owner, pSource->Owner))
 		{
 			if (!pWHExt->SuppressRevengeWeapons || (hasFilters && !pWHExt->SuppressRevengeWeapons_Types.Contains(pTypeExt->RevengeWeapon)))
-				WeaponTypeExt::DetonateAt(pTypeExt->RevengeWeapon, pSource, pThis);
+				WeaponTypeExt::QueueDetonation(pTypeExt->RevengeWeapon, pSource->GetCoords(), pThis, pThis->Owner, pSource);
 		}
 
 		for (auto& attachEffect : pExt->AttachedEffects)
@@ -139,8 +213,10 @@ DEFINE_HOOK(0x702672, TechnoClass_ReceiveDamage_RevengeWeapon, 0x5)
 				continue;
 
 			if (EnumFunctions::CanTargetHouse(pType->RevengeWeapon_AffectsHouses, pThis->Owner, pSource->Owner))
-				WeaponTypeExt::DetonateAt(pType->RevengeWeapon, pSource, pThis);
+				WeaponTypeExt::QueueDetonation(pType->RevengeWeapon, pSource->GetCoords(), pThis, pThis->Owner, pSource);
 		}
+
+		WeaponTypeExt::FlushDetonations();
 	}
 
 	return 0;
@@ -181,10 +257,15 @@ DEFINE_HOOK(0x518505, InfantryClass_ReceiveDamage_NotHuman, 0x4)
 DEFINE_HOOK(0x702050, TechnoClass_ReceiveDamage_AttachEffectExpireWeapon, 0x6)
 {
 	GET(TechnoClass*, pThis, ESI);
+	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
+
+	auto const context = ReceiveDamageTemp::Get(pThis, pWarhead);
 
-	auto const pExt = TechnoExt::ExtMap.Find(pThis);
+	if (!context.Has(ReceiveDamageFeature::DeathExpireWeapon))
+		return 0;
+
+	auto const pExt = context.Ext;
 	std::set<AttachEffectTypeClass*> cumulativeTypes;
-	std::vector<WeaponTypeClass*> expireWeapons;
 
 	for (auto const& attachEffect : pExt->AttachedEffects)
 	{
@@ -197,18 +278,12 @@ DEFINE_HOOK(0x702050, TechnoClass_ReceiveDamage_AttachEffectExpireWeapon, 0x6)
 				if (pType->Cumulative && pType->ExpireWeapon_CumulativeOnlyOnce)
 					cumulativeTypes.insert(pType);
 
-				expireWeapons.push_back(pType->ExpireWeapon);
+				WeaponTypeExt::QueueDetonation(pType->ExpireWeapon, pThis->GetCoords(), pThis, pThis->Owner, pThis);
 			}
 		}
 	}
 
-	auto const coords = pThis->GetCoords();
-	auto const pOwner = pThis->Owner;
-
-	for (auto const& pWeapon : expireWeapons)
-	{
-		WeaponTypeExt::DetonateAt(pWeapon, coords, pThis, pOwner, pThis);
-	}
+	WeaponTypeExt::FlushDetonations();
 
 	return 0;
 }
@@ -221,13 +296,18 @@ DEFINE_HOOK(0x701E18, TechnoClass_ReceiveDamage_ReflectDamage, 0x7)
 	GET_STACK(HouseClass*, pSourceHouse, STACK_OFFSET(0xC4, 0x1C));
 	GET_STACK(WarheadTypeClass*, pWarhead, STACK_OFFSET(0xC4, 0xC));
 
-	auto const pExt = TechnoExt::ExtMap.Find(pThis);
-	auto const pWHExt = WarheadTypeExt::ExtMap.Find(pWarhead);
+	auto const context = ReceiveDamageTemp::Get(pThis, pWarhead);
+
+	if (!context.Has(ReceiveDamageFeature::ReflectDamage))
+		return 0;
+
+	auto const pExt = context.Ext;
+	auto const pWHExt = context.WHExt;
 
 	if (pWHExt->Reflected)
 		return 0;
 
-	if (pExt->AE.ReflectDamage && *pDamage > 0 && (!pWHExt->SuppressReflectDamage || pWHExt->SuppressReflectDamage_Types.size() > 0))
+	if (*pDamage > 0 && (!pWHExt->SuppressReflectDamage || pWHExt->SuppressReflectDamage_Types.size() > 0))
 	{
 		for (auto& attachEffect : pExt->AttachedEffects)
 		{
@@ -17,7 +17,7 @@ DEFINE_HOOK(0x7012C2, TechnoClass_WeaponRange, 0x8)
 
 	if (pWeapon)
 	{
-		result = WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis);
+		result = TechnoExt::GetWeaponRange(pThis, pWeapon);
 		auto pTypeExt = TechnoTypeExt::ExtMap.Find(pThis->GetTechnoType());
 
 		if (pThis->GetTechnoType()->OpenTopped && !pTypeExt->OpenTopped_IgnoreRangefinding)
@@ -39,7 +39,7 @@ DEFINE_HOOK(0x7012C2, TechnoClass_WeaponRange, 0x8)
 
 				if (pTWeapon && pTWeapon->FireInTransport)
 				{
-					int range = WeaponTypeExt::GetRangeWithModifiers(pTWeapon, pPassenger);
+					int range = TechnoExt::GetWeaponRange(pPassenger, pTWeapon);
 
 					if (range < smallestRange)
 						smallestRange = range;
@@ -64,7 +64,7 @@ DEFINE_HOOK(0x6F7248, TechnoClass_InRange_WeaponRange, 0x6)
 	GET(TechnoClass*, pThis, ESI);
 	GET(WeaponTypeClass*, pWeapon, EBX);
 
-	R->EDI(WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis));
+	R->EDI(TechnoExt::GetWeaponRange(pThis, pWeapon));
 
 	return SkipGameCode;
 }
@@ -91,7 +91,7 @@ DEFINE_HOOK(0x6FC3A1, TechnoClass_CanFire_InBunkerRangeCheck, 0x5)
 	GET(TechnoClass*, pThis, EBP);
 	GET(WeaponTypeClass*, pWeapon, EDI);
 
-	if (pThis->WhatAmI() == AbstractType::Unit && WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis) < 384.0)
+	if (pThis->WhatAmI() == AbstractType::Unit && TechnoExt::GetWeaponRange(pThis, pWeapon) < 384.0)
 		return CannotFire;
 
 	return ContinueChecks;
@@ -104,7 +104,7 @@ DEFINE_HOOK(0x70CF6F, TechnoClass_ThreatCoefficients_WeaponRange, 0x6)
 	GET(TechnoClass*, pThis, EDI);
 	GET(WeaponTypeClass*, pWeapon, EBX);
 
-	R->EAX(WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis));
+	R->EAX(TechnoExt::GetWeaponRange(pThis, pWeapon));
 
 	return SkipGameCode;
 }
@@ -117,7 +117,7 @@ DEFINE_HOOK(0x41810F, AircraftClass_MissionAttack_WeaponRangeCheck1, 0x6)
 	GET(WeaponTypeClass*, pWeapon, EDI);
 	GET(int, distance, EAX);
 
-	int range = WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis);
+	int range = TechnoExt::GetWeaponRange(pThis, pWeapon);
 
 	if (distance < range)
 		return WithinDistance;
@@ -132,7 +132,7 @@ DEFINE_HOOK(0x418BA8, AircraftClass_MissionAttack_WeaponRangeCheck2, 0x6)
 	GET(AircraftClass*, pThis, ESI);
 	GET(WeaponTypeClass*, pWeapon, EAX);
 
-	R->EAX(WeaponTypeExt::GetRangeWithModifiers(pWeapon, pThis));
+	R->EAX(TechnoExt::GetWeaponRange(pThis, pWeapon));
 
 	return SkipGameCode;
 }
@@ -244,7 +244,7 @@ bool __fastcall TechnoClass_Limbo_Wrapper(TechnoClass* pThis)
 		pExt->RecalculateStatMultipliers();
 
 	if (markForRedraw)
-		pExt->OwnerObject()->MarkForRedraw();
+		pExt->UpdateCustomTint();
 
 	return pThis->TechnoClass::Limbo();
 }
@@ -32,6 +32,21 @@ void TechnoTypeExt::ExtData::ApplyTurretOffset(Matrix3D* mtx, double factor)
 	mtx->Translate(x, y, z);
 }
 
+// Resolves pip sizes that only depend on type & rules data so pip drawing doesn't have to.
+void TechnoTypeExt::ExtData::ResolvePipLayout()
+{
+	if (this->PipLayout_Generation == RulesExt::PipLayoutGeneration)
+		return;
+
+	this->PipLayout_Generation = RulesExt::PipLayoutGeneration;
+	auto const pRulesExt = RulesExt::Global();
+	const bool isBuilding = this->OwnerObject()->WhatAmI() == AbstractType::BuildingType;
+
+	this->PipLayout_GenericSize = isBuilding ? pRulesExt->Pips_Generic_Buildings_Size : pRulesExt->Pips_Generic_Size;
+	this->PipLayout_AmmoSize = this->AmmoPipSize.Get(isBuilding ? pRulesExt->Pips_Ammo_Buildings_Size : pRulesExt->Pips_Ammo_Size);
+	this->PipLayout_SpawnsSize = this->SpawnsPipSize.Get(this->PipLayout_GenericSize);
+}
+
 // Ares 0.A source
 const char* TechnoTypeExt::ExtData::GetSelectionGroupID() const
 {
@@ -795,6 +810,8 @@ void TechnoTypeExt::ExtData::Serialize(T& Stm)
 		.Process(this->SpawnsPipSize)
 		.Process(this->SpawnsPipOffset)
 
+		.Process(this->AITargetTypesListMask)
+
 		.Process(this->SpawnDistanceFromTarget)
 		.Process(this->SpawnHeight)
 		.Process(this->LandingDir)
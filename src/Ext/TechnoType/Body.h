@@ -198,6 +198,15 @@ public:
 		Nullable<Point2D> SpawnsPipSize;
 		Valueable<Point2D> SpawnsPipOffset;
 
+		// Pip sizes resolved against [AudioVisual] defaults on first draw after INI loading, see ResolvePipLayout().
+		Point2D PipLayout_AmmoSize;
+		Point2D PipLayout_GenericSize;
+		Point2D PipLayout_SpawnsSize;
+		int PipLayout_Generation;
+
+		// One bit per [AITargetTypes] list containing this type, see RulesExt::ResolveAITargetTypes().
+		std::vector<DWORD> AITargetTypesListMask;
+
 		Nullable<Leptons> SpawnDistanceFromTarget;
 		Nullable<int> SpawnHeight;
 		Nullable<int> LandingDir;
@@ -420,6 +429,12 @@ public:
 			, SpawnsPipSize {}
 			, SpawnsPipOffset { { 0,0 } }
 
+			, PipLayout_AmmoSize {}
+			, PipLayout_GenericSize {}
+			, PipLayout_SpawnsSize {}
+			, PipLayout_Generation { -1 }
+			, AITargetTypesListMask {}
+
 			, SpawnDistanceFromTarget {}
 			, SpawnHeight {}
 			, LandingDir {}
@@ -464,6 +479,13 @@ public:
 		virtual void SaveToStream(PhobosStreamWriter& Stm) override;
 
 		void ApplyTurretOffset(Matrix3D* mtx, double factor = 1.0);
+		void ResolvePipLayout();
+
+		bool IsInAITargetTypesList(int index) const
+		{
+			const size_t word = static_cast<size_t>(index) / 32;
+			return index >= 0 && word < this->AITargetTypesListMask.size() && ((this->AITargetTypesListMask[word] >> (index % 32)) & 1);
+		}
 
 		// Ares 0.A
 		const char* GetSelectionGroupID() const;
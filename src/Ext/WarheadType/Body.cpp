@@ -131,6 +131,24 @@ DamageAreaResult WarheadTypeExt::ExtData::DamageAreaWithTarget(const CoordStruct
 	return result;
 }
 
+double WarheadTypeExt::ExtData::CalculateVersusArmor(Armor armorType)
+{
+	// Goes through GetTotalDamage so Ares custom armors and their verses are respected.
+	const double versus = double(MapClass::GetTotalDamage(100, this->OwnerObject(), armorType, 0)) / 100.0;
+
+	if (static_cast<int>(armorType) < 0)
+		return versus;
+
+	const size_t index = static_cast<size_t>(armorType);
+
+	if (index >= this->VersusArmor.size())
+		this->VersusArmor.resize(index + 1, VersusNotCalculated);
+
+	this->VersusArmor[index] = versus;
+
+	return versus;
+}
+
 // =============================
 // load / save
 
@@ -139,6 +157,9 @@ void WarheadTypeExt::ExtData::LoadFromINIFile(CCINIClass* const pINI)
 	auto pThis = this->OwnerObject();
 	const char* pSection = pThis->ID;
 
+	// Verses may be overridden by map rules.
+	this->VersusArmor.clear();
+
 	if (!pINI->GetSection(pSection))
 		return;
 
@@ -320,6 +341,28 @@ void WarheadTypeExt::ExtData::LoadFromINIFile(CCINIClass* const pINI)
 		|| this->AttachEffects.RemoveGroups.size() > 0
 	);
 
+	// Used in WarheadTypeExt::ExtData::ApplyCrit
+	{
+		auto const affects = this->Crit_Affects.Get();
+		auto const affectedCells = affects & AffectedTarget::AllCells;
+		auto const affectedTechnos = affects & (AffectedTarget::Infantry | AffectedTarget::Unit | AffectedTarget::Building);
+		auto checks = CritTargetCheck::None;
+
+		if ((this->Crit_AffectsHouses & AffectedHouse::All) != AffectedHouse::All)
+			checks |= CritTargetCheck::Houses;
+
+		if (affects == AffectedTarget::None || (affectedCells != AffectedTarget::None && affectedCells != AffectedTarget::AllCells))
+			checks |= CritTargetCheck::Cells;
+
+		if (affects == AffectedTarget::None || ((affects & AffectedTarget::AllContents) != AffectedTarget::None
+			&& affectedTechnos != (AffectedTarget::Infantry | AffectedTarget::Unit | AffectedTarget::Building)))
+		{
+			checks |= CritTargetCheck::Technos;
+		}
+
+		this->Crit_TargetChecks = checks;
+	}
+
 	char tempBuffer[32];
 	Nullable<Powerup> crateType;
 	Nullable<int> weight;
@@ -497,6 +540,7 @@ void WarheadTypeExt::ExtData::Serialize(T& Stm)
 		.Process(this->WasDetonatedOnAllMapObjects)
 		.Process(this->RemainingAnimCreationInterval)
 		.Process(this->PossibleCellSpreadDetonate)
+		.Process(this->Crit_TargetChecks)
 		.Process(this->Reflected)
 		.Process(this->DamageAreaTarget)
 		;
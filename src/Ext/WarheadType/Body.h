@@ -4,11 +4,23 @@
 #include <Helpers/Macro.h>
 #include <Utilities/Container.h>
 #include <Utilities/TemplateDef.h>
+#include <Utilities/Helpers.Alex.h>
 #include <New/Type/ShieldTypeClass.h>
 #include <Ext/Bullet/Body.h>
 #include <Ext/Techno/Body.h>
 #include <New/Type/Affiliated/TypeConvertGroup.h>
 
+// Crit target checks that can actually reject a target for a warhead, the rest pass for every target.
+enum class CritTargetCheck : unsigned char
+{
+	None = 0x0,
+	Houses = 0x1,
+	Cells = 0x2,
+	Technos = 0x4
+};
+
+MAKE_ENUM_FLAGS(CritTargetCheck);
+
 class WarheadTypeExt
 {
 public:
@@ -165,8 +177,13 @@ public:
 		bool Reflected;
 		int RemainingAnimCreationInterval;
 		bool PossibleCellSpreadDetonate;
+		CritTargetCheck Crit_TargetChecks;
 		TechnoClass* DamageAreaTarget;
 
+		// Versus multipliers indexed by armor type, filled on first lookup and dropped whenever the warhead is read from INI again.
+		// Ares custom armors extend the armor range, so the row grows as needed. Not saved.
+		std::vector<double> VersusArmor;
+
 	private:
 		Valueable<double> Shield_Respawn_Rate_InMinutes;
 		Valueable<double> Shield_SelfHealing_Rate_InMinutes;
@@ -315,7 +332,9 @@ public:
 			, Reflected { false }
 			, RemainingAnimCreationInterval { 0 }
 			, PossibleCellSpreadDetonate { false }
+			, Crit_TargetChecks { CritTargetCheck::None }
 			, DamageAreaTarget {}
+			, VersusArmor {}
 		{ }
 
 		void ApplyConvert(HouseClass* pHouse, TechnoClass* pTarget);
@@ -327,6 +346,19 @@ public:
 		bool CanAffectInvulnerable(TechnoClass* pTarget) const;
 		bool EligibleForFullMapDetonation(TechnoClass* pTechno, HouseClass* pOwner) const;
 
+		double GetVersusArmor(Armor armorType)
+		{
+			const size_t index = static_cast<size_t>(armorType);
+
+			if (index < this->VersusArmor.size() && this->VersusArmor[index] != VersusNotCalculated)
+				return this->VersusArmor[index];
+
+			return this->CalculateVersusArmor(armorType);
+		}
+
+		double CalculateVersusArmor(Armor armorType);
+		static constexpr double VersusNotCalculated = std::numeric_limits<double>::lowest();
+
 		virtual ~ExtData() = default;
 		virtual void LoadFromINIFile(CCINIClass* pINI) override;
 		virtual void InvalidatePointer(void* ptr, bool bRemoved) override { }
@@ -365,4 +397,19 @@ public:
 
 	static void DetonateAt(WarheadTypeClass* pThis, AbstractClass* pTarget, TechnoClass* pOwner, int damage, HouseClass* pFiringHouse = nullptr);
 	static void DetonateAt(WarheadTypeClass* pThis, const CoordStruct& coords, TechnoClass* pOwner, int damage, HouseClass* pFiringHouse = nullptr, AbstractClass* pTarget = nullptr);
+
+	static void GetCellSpreadTargets(std::vector<TechnoClass*>& targets, const CoordStruct& coords, float cellSpread);
+	static void ClearCellSpreadBatches();
+
+private:
+	// Cell spread candidates gathered this frame, shared by detonations in the same cell with the same spread.
+	struct CellSpreadBatch
+	{
+		CellStruct Cell;
+		float CellSpread;
+		std::vector<Helpers::Alex::CellSpreadCandidate> Candidates;
+	};
+
+	static std::vector<CellSpreadBatch> CellSpreadBatches;
+	static int CellSpreadBatchesFrame;
 };
@@ -11,11 +11,15 @@
 
 #include <Ext/Anim/Body.h>
 #include <Ext/Bullet/Body.h>
+#include <Ext/Rules/Body.h>
 #include <Ext/BulletType/Body.h>
 #include <Ext/SWType/Body.h>
 #include <Misc/FlyingStrings.h>
 #include <Utilities/Helpers.Alex.h>
 #include <Utilities/EnumFunctions.h>
+#include <Utilities/Profiler.h>
+
+DEFINE_PROFILE_SECTION(Profile_GetCellSpreadItems, "Helpers::Alex::getCellSpreadItems");
 
 void WarheadTypeExt::ExtData::Detonate(TechnoClass* pOwner, HouseClass* pHouse, BulletExt::ExtData* pBulletExt, CoordStruct coords)
 {
@@ -122,7 +126,14 @@ void WarheadTypeExt::ExtData::Detonate(TechnoClass* pOwner, HouseClass* pHouse,
 
 		if (cellSpread)
 		{
-			for (auto pTarget : Helpers::Alex::getCellSpreadItems(coords, cellSpread, true))
+			Helpers::Alex::CellSpreadBuffer targets;
+
+			{
+				PROFILE_SCOPE(Profile_GetCellSpreadItems);
+				WarheadTypeExt::GetCellSpreadTargets(targets.Items, coords, cellSpread);
+			}
+
+			for (auto pTarget : targets.Items)
 				this->DetonateOnOneUnit(pHouse, pTarget, pOwner, bulletWasIntercepted);
 		}
 		else if (pBullet)
@@ -143,6 +154,44 @@ void WarheadTypeExt::ExtData::Detonate(TechnoClass* pOwner, HouseClass* pHouse,
 	}
 }
 
+std::vector<WarheadTypeExt::CellSpreadBatch> WarheadTypeExt::CellSpreadBatches;
+int WarheadTypeExt::CellSpreadBatchesFrame = -1;
+
+void WarheadTypeExt::GetCellSpreadTargets(std::vector<TechnoClass*>& targets, const CoordStruct& coords, float cellSpread)
+{
+	if (!RulesExt::Global()->BatchCellSpreadDetonations)
+	{
+		Helpers::Alex::getCellSpreadItems(targets, coords, cellSpread, true);
+		return;
+	}
+
+	if (CellSpreadBatchesFrame != Unsorted::CurrentFrame)
+	{
+		WarheadTypeExt::ClearCellSpreadBatches();
+		CellSpreadBatchesFrame = Unsorted::CurrentFrame;
+	}
+
+	// Salvos tend to land in the same few cells, so only the cells are gathered once.
+	// The distance checks depend on the exact impact coordinates and still run per detonation.
+	auto const cell = CellClass::Coord2Cell(coords);
+	auto it = std::find_if(CellSpreadBatches.begin(), CellSpreadBatches.end(),
+		[&cell, cellSpread](CellSpreadBatch const& batch) { return batch.Cell == cell && batch.CellSpread == cellSpread; });
+
+	if (it == CellSpreadBatches.end())
+	{
+		CellSpreadBatches.push_back({ cell, cellSpread, {} });
+		it = CellSpreadBatches.end() - 1;
+		Helpers::Alex::getCellSpreadCandidates(it->Candidates, coords, cellSpread, true);
+	}
+
+	Helpers::Alex::selectCellSpreadItems(targets, it->Candidates, coords, cellSpread);
+}
+
+void WarheadTypeExt::ClearCellSpreadBatches()
+{
+	CellSpreadBatches.clear();
+}
+
 void WarheadTypeExt::ExtData::DetonateOnOneUnit(HouseClass* pHouse, TechnoClass* pTarget, TechnoClass* pOwner, bool bulletWasIntercepted)
 {
 	if (!pTarget || pTarget->InLimbo || !pTarget->IsAlive || !pTarget->Health || pTarget->IsSinking || pTarget->BeingWarpedOut)
@@ -202,6 +251,7 @@ void WarheadTypeExt::ExtData::ApplyShieldModifiers(TechnoClass* pTarget, TechnoE
 				pTargetExt->CurrentShieldType = ShieldTypeClass::FindOrAllocate(NONE_STR);
 				pTargetExt->Shield->KillAnim();
 				pTargetExt->Shield = nullptr;
+				pTargetExt->UpdateCustomTint();
 			}
 		}
 
@@ -237,6 +287,8 @@ void WarheadTypeExt::ExtData::ApplyShieldModifiers(TechnoClass* pTarget, TechnoE
 						if (pTargetExt->Shield->GetHP() == 0)
 							pTargetExt->Shield->SetRespawn(shieldType->Respawn_Rate, shieldType->Respawn, shieldType->Respawn_Rate, true);
 					}
+
+					pTargetExt->UpdateCustomTint();
 				}
 			}
 		}
@@ -317,13 +369,18 @@ void WarheadTypeExt::ExtData::ApplyCrit(HouseClass* pHouse, TechnoClass* pTarget
 			return;
 	}
 
-	if (pHouse && !EnumFunctions::CanTargetHouse(this->Crit_AffectsHouses, pHouse, pTarget->Owner))
+	auto const checks = this->Crit_TargetChecks;
+
+	if ((checks & CritTargetCheck::Houses) != CritTargetCheck::None
+		&& pHouse && !EnumFunctions::CanTargetHouse(this->Crit_AffectsHouses, pHouse, pTarget->Owner))
+	{
 		return;
+	}
 
-	if (!EnumFunctions::IsCellEligible(pTarget->GetCell(), this->Crit_Affects))
+	if ((checks & CritTargetCheck::Cells) != CritTargetCheck::None && !EnumFunctions::IsCellEligible(pTarget->GetCell(), this->Crit_Affects))
 		return;
 
-	if (!EnumFunctions::IsTechnoEligible(pTarget, this->Crit_Affects))
+	if ((checks & CritTargetCheck::Technos) != CritTargetCheck::None && !EnumFunctions::IsTechnoEligible(pTarget, this->Crit_Affects))
 		return;
 
 	this->Crit_Active = true;
@@ -477,6 +534,10 @@ double WarheadTypeExt::ExtData::GetCritChance(TechnoClass* pFirer) const
 		return critChance;
 
 	auto const pExt = TechnoExt::ExtMap.Find(pFirer);
+
+	if (!pExt->AE.HasCritModifiers)
+		return critChance;
+
 	double extraChance = 0.0;
 
 	for (auto& attachEffect : pExt->AttachedEffects)
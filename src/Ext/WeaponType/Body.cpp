@@ -4,12 +4,15 @@
 
 WeaponTypeExt::ExtContainer WeaponTypeExt::ExtMap;
 
-bool WeaponTypeExt::ExtData::HasRequiredAttachedEffects(TechnoClass* pTarget, TechnoClass* pFirer) const
+bool WeaponTypeExt::ExtData::HasRequiredAttachedEffects(TechnoClass* pTarget, TechnoClass* pFirer)
 {
+	if (!this->AttachEffect_GroupsResolved)
+		this->ResolveAttachEffectGroups();
+
 	bool hasRequiredTypes = this->AttachEffect_RequiredTypes.size() > 0;
 	bool hasDisallowedTypes = this->AttachEffect_DisallowedTypes.size() > 0;
-	bool hasRequiredGroups = this->AttachEffect_RequiredGroups.size() > 0;
-	bool hasDisallowedGroups = this->AttachEffect_DisallowedGroups.size() > 0;
+	bool hasRequiredGroups = this->AttachEffect_RequiredGroupTypes.size() > 0;
+	bool hasDisallowedGroups = this->AttachEffect_DisallowedGroupTypes.size() > 0;
 
 	if (hasRequiredTypes || hasDisallowedTypes || hasRequiredGroups || hasDisallowedGroups)
 	{
@@ -26,20 +29,29 @@ bool WeaponTypeExt::ExtData::HasRequiredAttachedEffects(TechnoClass* pTarget, Te
 		if (hasDisallowedTypes && pTechnoExt->HasAttachedEffects(this->AttachEffect_DisallowedTypes, false, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_DisallowedMinCounts, &this->AttachEffect_DisallowedMaxCounts))
 			return false;
 
-		if (hasDisallowedGroups && pTechnoExt->HasAttachedEffects(AttachEffectTypeClass::GetTypesFromGroups(this->AttachEffect_DisallowedGroups), false, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_DisallowedMinCounts, &this->AttachEffect_DisallowedMaxCounts))
+		if (hasDisallowedGroups && pTechnoExt->HasAttachedEffects(this->AttachEffect_DisallowedGroupTypes, false, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_DisallowedMinCounts, &this->AttachEffect_DisallowedMaxCounts))
 			return false;
 
 		if (hasRequiredTypes && !pTechnoExt->HasAttachedEffects(this->AttachEffect_RequiredTypes, true, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_RequiredMinCounts, &this->AttachEffect_RequiredMaxCounts))
 			return false;
 
 		if (hasRequiredGroups &&
-			!pTechnoExt->HasAttachedEffects(AttachEffectTypeClass::GetTypesFromGroups(this->AttachEffect_RequiredGroups), true, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_RequiredMinCounts, &this->AttachEffect_RequiredMaxCounts))
+			!pTechnoExt->HasAttachedEffects(this->AttachEffect_RequiredGroupTypes, true, this->AttachEffect_IgnoreFromSameSource, pFirer, this->OwnerObject()->Warhead, &this->AttachEffect_RequiredMinCounts, &this->AttachEffect_RequiredMaxCounts))
 			return false;
 	}
 
 	return true;
 }
 
+// Group lookups build a set and a vector each time, so CanFire checks use the expanded types instead.
+// Resolved on first use as map INIs can still change the groups of weapons and AttachEffect types.
+void WeaponTypeExt::ExtData::ResolveAttachEffectGroups()
+{
+	this->AttachEffect_RequiredGroupTypes = AttachEffectTypeClass::GetTypesFromGroups(this->AttachEffect_RequiredGroups);
+	this->AttachEffect_DisallowedGroupTypes = AttachEffectTypeClass::GetTypesFromGroups(this->AttachEffect_DisallowedGroups);
+	this->AttachEffect_GroupsResolved = true;
+}
+
 void WeaponTypeExt::ExtData::Initialize()
 {
 	this->RadType = RadTypeClass::FindOrAllocate(GameStrings::Radiation);
@@ -67,6 +79,9 @@ void WeaponTypeExt::ExtData::LoadFromINIFile(CCINIClass* const pINI)
 	auto pThis = this->OwnerObject();
 	const char* pSection = pThis->ID;
 
+	// Any INI read may change this weapon's groups or the groups of AttachEffect types.
+	this->AttachEffect_GroupsResolved = false;
+
 	if (!pINI->GetSection(pSection))
 		return;
 
@@ -224,6 +239,47 @@ void WeaponTypeExt::DetonateAt(WeaponTypeClass* pThis, const CoordStruct& coords
 	}
 }
 
+// Expire and revenge weapons are queued and fired by the outermost FlushDetonations() call instead of detonating
+// right away, so detonations triggered by them are appended to the queue rather than nesting further damage chains.
+// Queue is always empty outside of a flush, so it does not need to be saved.
+std::vector<WeaponTypeExt::QueuedDetonation> WeaponTypeExt::QueuedDetonations;
+bool WeaponTypeExt::IsFlushingDetonations = false;
+
+void WeaponTypeExt::QueueDetonation(WeaponTypeClass* pThis, const CoordStruct& coords, TechnoClass* pOwner, HouseClass* pFiringHouse, AbstractClass* pTarget)
+{
+	QueuedDetonations.push_back({ pThis, coords, pOwner, pFiringHouse, pTarget });
+}
+
+void WeaponTypeExt::FlushDetonations()
+{
+	if (IsFlushingDetonations)
+		return;
+
+	IsFlushingDetonations = true;
+
+	// Detonations queued while flushing are fired after the current ones, in the order they were queued.
+	for (size_t i = 0; i < QueuedDetonations.size(); i++)
+	{
+		auto const detonation = QueuedDetonations[i];
+		WeaponTypeExt::DetonateAt(detonation.Weapon, detonation.Coords, detonation.Owner, detonation.FiringHouse, detonation.Target);
+	}
+
+	QueuedDetonations.clear();
+	IsFlushingDetonations = false;
+}
+
+void WeaponTypeExt::PointerGotInvalid(void* ptr, bool removed)
+{
+	for (auto& detonation : QueuedDetonations)
+	{
+		if (detonation.Owner == ptr)
+			detonation.Owner = nullptr;
+
+		if (detonation.Target == ptr)
+			detonation.Target = nullptr;
+	}
+}
+
 int WeaponTypeExt::GetRangeWithModifiers(WeaponTypeClass* pThis, TechnoClass* pFirer)
 {
 	int range = 0;
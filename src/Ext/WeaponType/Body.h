@@ -59,6 +59,10 @@ public:
 		ValueableVector<int> AttachEffect_DisallowedMaxCounts;
 		Valueable<bool> AttachEffect_CheckOnFirer;
 		Valueable<bool> AttachEffect_IgnoreFromSameSource;
+		// AttachEffect groups expanded to types on first use after INI loading, see ResolveAttachEffectGroups().
+		std::vector<AttachEffectTypeClass*> AttachEffect_RequiredGroupTypes;
+		std::vector<AttachEffectTypeClass*> AttachEffect_DisallowedGroupTypes;
+		bool AttachEffect_GroupsResolved;
 		Valueable<bool> KickOutPassengers;
 
 		ExtData(WeaponTypeClass* OwnerObject) : Extension<WeaponTypeClass>(OwnerObject)
@@ -100,12 +104,16 @@ public:
 			, AttachEffect_DisallowedMaxCounts {}
 			, AttachEffect_CheckOnFirer { false }
 			, AttachEffect_IgnoreFromSameSource { false }
+			, AttachEffect_RequiredGroupTypes {}
+			, AttachEffect_DisallowedGroupTypes {}
+			, AttachEffect_GroupsResolved { false }
 			, KickOutPassengers { true }
 		{ }
 
 		int GetBurstDelay(int burstIndex) const;
 
-		bool HasRequiredAttachedEffects(TechnoClass* pTechno, TechnoClass* pFirer) const;
+		bool HasRequiredAttachedEffects(TechnoClass* pTechno, TechnoClass* pFirer);
+		void ResolveAttachEffectGroups();
 
 		virtual ~ExtData() = default;
 
@@ -143,4 +151,20 @@ public:
 	static void DetonateAt(WeaponTypeClass* pThis, const CoordStruct& coords, TechnoClass* pOwner, int damage, HouseClass* pFiringHouse = nullptr, AbstractClass* pTarget = nullptr);
 	static int GetRangeWithModifiers(WeaponTypeClass* pThis, TechnoClass* pFirer);
 	static int GetRangeWithModifiers(WeaponTypeClass* pThis, TechnoClass* pFirer, int range);
+	static void QueueDetonation(WeaponTypeClass* pThis, const CoordStruct& coords, TechnoClass* pOwner, HouseClass* pFiringHouse, AbstractClass* pTarget = nullptr);
+	static void FlushDetonations();
+	static void PointerGotInvalid(void* ptr, bool removed);
+
+private:
+	struct QueuedDetonation
+	{
+		WeaponTypeClass* Weapon;
+		CoordStruct Coords;
+		TechnoClass* Owner;
+		HouseClass* FiringHouse;
+		AbstractClass* Target;
+	};
+
+	static std::vector<QueuedDetonation> QueuedDetonations;
+	static bool IsFlushingDetonations;
 };
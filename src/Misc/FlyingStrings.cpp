@@ -8,9 +8,12 @@
 #include <ScenarioClass.h>
 #include <BitFont.h>
 #include <Utilities/EnumFunctions.h>
+#include <Utilities/Profiler.h>
 
 std::vector<FlyingStrings::Item> FlyingStrings::Data;
 
+DEFINE_PROFILE_SECTION(Profile_FlyingStrings, "FlyingStrings::UpdateAll");
+
 bool FlyingStrings::DrawAllowed(CoordStruct& nCoords)
 {
 	if (auto const pCell = MapClass::Instance->TryGetCellAt(nCoords))
@@ -50,6 +53,8 @@ void FlyingStrings::AddMoneyString(int amount, HouseClass* owner, AffectedHouse
 
 void FlyingStrings::UpdateAll()
 {
+	PROFILE_SCOPE(Profile_FlyingStrings);
+
 	if (Data.empty())
 		return;
 
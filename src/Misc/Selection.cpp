@@ -6,6 +6,9 @@
 #include <HouseClass.h>
 #include <Unsorted.h>
 
+#include <algorithm>
+#include <vector>
+
 class ExtSelection
 {
 public:
@@ -56,50 +59,194 @@ public:
 		return false;
 	}
 
-	static bool Tactical_IsHighPriorityInRect(TacticalClass* pThis, LTRBStruct* rect)
+	// Screen-space bucket grid over TacticalSelectables, rebuilt at most once per frame
+	// so band-box selection only has to visit the buckets overlapping the rectangle.
+	static inline class SelectableGrid
 	{
-		for (const auto& selected : Array)
-			if (Tactical_IsInSelectionRect(pThis, rect, selected) && ObjectClass_IsSelectable(selected.Techno))
-				if (!TechnoTypeExt::ExtMap.Find(selected.Techno->GetTechnoType())->LowSelectionPriority)
-					return true;
+	public:
+		static constexpr int BucketSize = 128;
 
-		return false;
-	}
+		struct Entry
+		{
+			int Index;
+			bool LowPriority;
+		};
+
+		void Update()
+		{
+			const int count = static_cast<int>(Array.size());
+
+			if (this->Frame == Unsorted::CurrentFrame && this->Count == count)
+				return;
+
+			this->Frame = Unsorted::CurrentFrame;
+			this->Count = count;
+			this->Entries.clear();
+			this->Offsets.clear();
+
+			if (count <= 0)
+				return;
+
+			int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+
+			for (const auto& selectable : Array)
+			{
+				minX = Math::min(minX, selectable.X);
+				minY = Math::min(minY, selectable.Y);
+				maxX = Math::max(maxX, selectable.X);
+				maxY = Math::max(maxY, selectable.Y);
+			}
+
+			this->OriginX = minX;
+			this->OriginY = minY;
+			this->Width = (maxX - minX) / BucketSize + 1;
+			this->Height = (maxY - minY) / BucketSize + 1;
+
+			// Counting sort into contiguous buckets, keeping the original selectable order within each bucket.
+			this->Offsets.assign(this->Width * this->Height + 1, 0);
+			this->Buckets.resize(count);
+
+			for (int i = 0; i < count; ++i)
+			{
+				const auto& selectable = Array.begin()[i];
+				const int bucket = this->BucketOf(selectable.X, selectable.Y);
+				this->Buckets[i] = bucket;
+				++this->Offsets[bucket + 1];
+			}
+
+			for (size_t i = 1; i < this->Offsets.size(); ++i)
+				this->Offsets[i] += this->Offsets[i - 1];
+
+			this->Entries.resize(count);
+			this->Cursor.assign(this->Offsets.begin(), this->Offsets.end() - 1);
+
+			for (int i = 0; i < count; ++i)
+			{
+				const auto pTechno = Array.begin()[i].Techno;
+				bool lowPriority = false;
+
+				if (pTechno)
+				{
+					if (const auto pTypeExt = TechnoTypeExt::ExtMap.Find(pTechno->GetTechnoType()))
+						lowPriority = pTypeExt->LowSelectionPriority;
+				}
+
+				this->Entries[this->Cursor[this->Buckets[i]]++] = { i, lowPriority };
+			}
+		}
+
+		// Collects the entries inside the selection rectangle in their original TacticalSelectables order.
+		// Returns true if any of them is selectable and not of low selection priority.
+		bool Query(TacticalClass* pTactical, LTRBStruct* pRect, std::vector<Entry>& result)
+		{
+			result.clear();
+			bool hasHighPriority = false;
+
+			if (this->Entries.empty())
+				return false;
+
+			const int left = pTactical->TacticalPos.X + pRect->Left;
+			const int top = pTactical->TacticalPos.Y + pRect->Top;
+			const int right = left + pRect->Right - 1;
+			const int bottom = top + pRect->Bottom - 1;
+
+			const int x0 = Math::max((left - this->OriginX) / BucketSize, 0);
+			const int y0 = Math::max((top - this->OriginY) / BucketSize, 0);
+			const int x1 = Math::min((right - this->OriginX) / BucketSize, this->Width - 1);
+			const int y1 = Math::min((bottom - this->OriginY) / BucketSize, this->Height - 1);
+
+			if (right < this->OriginX || bottom < this->OriginY)
+				return false;
+
+			for (int y = y0; y <= y1; ++y)
+			{
+				for (int x = x0; x <= x1; ++x)
+				{
+					const int bucket = y * this->Width + x;
+
+					for (int i = this->Offsets[bucket]; i < this->Offsets[bucket + 1]; ++i)
+					{
+						const auto& entry = this->Entries[i];
+						const auto& selectable = Array.begin()[entry.Index];
+
+						if (!Tactical_IsInSelectionRect(pTactical, pRect, selectable))
+							continue;
+
+						result.push_back(entry);
+
+						if (!hasHighPriority && !entry.LowPriority && ObjectClass_IsSelectable(selectable.Techno))
+							hasHighPriority = true;
+					}
+				}
+			}
+
+			std::sort(result.begin(), result.end(),
+				[](const Entry& a, const Entry& b) { return a.Index < b.Index; });
+
+			return hasHighPriority;
+		}
+
+	private:
+		int BucketOf(int x, int y) const
+		{
+			return ((y - this->OriginY) / BucketSize) * this->Width + (x - this->OriginX) / BucketSize;
+		}
+
+		int Frame { -1 };
+		int Count { -1 };
+		int OriginX { 0 };
+		int OriginY { 0 };
+		int Width { 0 };
+		int Height { 0 };
+		std::vector<Entry> Entries {};
+		std::vector<int> Offsets {};
+		std::vector<int> Buckets {};
+		std::vector<int> Cursor {};
+	} Grid {};
+
+	static inline std::vector<SelectableGrid::Entry> InRect {};
 
 	// Reversed from Tactical::Select
-	static void Tactical_SelectFiltered(TacticalClass* pThis, LTRBStruct* pRect, callback_type check_callback, bool bPriorityFiltering)
+	static void Tactical_SelectFiltered(TacticalClass* pThis, LTRBStruct* pRect, callback_type check_callback)
 	{
 		Unsorted::MoveFeedback = true;
 
 		if (pRect->Right <= 0 || pRect->Bottom <= 0 || pThis->SelectableCount <= 0)
 			return;
 
-		for (const auto& selected : Array)
-			if (Tactical_IsInSelectionRect(pThis, pRect, selected))
+		Grid.Update();
+		const bool bPriorityFiltering = Grid.Query(pThis, pRect, InRect) && Phobos::Config::PrioritySelectionFiltering;
+
+		for (const auto& entry : InRect)
+		{
+			const auto pTechno = Array.begin()[entry.Index].Techno;
+
+			// The techno may have died while a previous one in the rectangle was being processed
+			if (!pTechno->IsAlive)
+				continue;
+
+			auto pTechnoType = pTechno->GetTechnoType();
+			auto TypeExt = TechnoTypeExt::ExtMap.Find(pTechnoType);
+
+			if (bPriorityFiltering && entry.LowPriority)
+				continue;
+
+			if (TypeExt && Game::IsTypeSelecting())
+				Game::UICommands_TypeSelect_7327D0(TypeExt->GetSelectionGroupID());
+			else if (check_callback)
+				(*check_callback)(pTechno);
+			else
 			{
-				const auto pTechno = selected.Techno;
-				auto pTechnoType = pTechno->GetTechnoType();
-				auto TypeExt = TechnoTypeExt::ExtMap.Find(pTechnoType);
-
-				if (bPriorityFiltering && TypeExt && TypeExt->LowSelectionPriority)
-					continue;
-
-				if (TypeExt && Game::IsTypeSelecting())
-					Game::UICommands_TypeSelect_7327D0(TypeExt->GetSelectionGroupID());
-				else if (check_callback)
-					(*check_callback)(pTechno);
-				else
-				{
-					const auto pBldType = abstract_cast<BuildingTypeClass*>(pTechnoType);
-					const auto pOwner = pTechno->GetOwningHouse();
+				const auto pBldType = abstract_cast<BuildingTypeClass*>(pTechnoType);
+				const auto pOwner = pTechno->GetOwningHouse();
 
-					if (pOwner && pOwner->IsControlledByCurrentPlayer() && pTechno->CanBeSelected()
-						&& (!pBldType || (pBldType && pBldType->UndeploysInto && pBldType->IsVehicle())))
-					{
-						Unsorted::MoveFeedback = !pTechno->Select();
-					}
+				if (pOwner && pOwner->IsControlledByCurrentPlayer() && pTechno->CanBeSelected()
+					&& (!pBldType || (pBldType && pBldType->UndeploysInto && pBldType->IsVehicle())))
+				{
+					Unsorted::MoveFeedback = !pTechno->Select();
 				}
 			}
+		}
 
 		Unsorted::MoveFeedback = true;
 	}
@@ -121,8 +268,7 @@ public:
 
 			LTRBStruct rect { nLeft , nTop, nRight - nLeft + 1, nBottom - nTop + 1 };
 
-			bool bPriorityFiltering = Phobos::Config::PrioritySelectionFiltering && Tactical_IsHighPriorityInRect(pThis, &rect);
-			Tactical_SelectFiltered(pThis, &rect, check_callback, bPriorityFiltering);
+			Tactical_SelectFiltered(pThis, &rect, check_callback);
 
 			pThis->Band.Left = 0;
 			pThis->Band.Top = 0;
@@ -107,9 +107,6 @@ void AttachEffectClass::AI()
 			if (!pExt->ChargeTurretTimer.HasStarted() && pExt->LastRearmWasFullDelay)
 				pTechno->ChargeTurretDelay = static_cast<int>(pTechno->ChargeTurretDelay * ROFModifier);
 		}
-
-		if (this->Type->HasTint())
-			this->Techno->MarkForRedraw();
 	}
 
 	if (this->CurrentDelay > 0)
@@ -534,7 +531,7 @@ int AttachEffectClass::Attach(TechnoClass* pTarget, HouseClass* pInvokerHouse, T
 		pTargetExt->RecalculateStatMultipliers();
 
 	if (markForRedraw)
-		pTarget->MarkForRedraw();
+		pTargetExt->UpdateCustomTint();
 
 	return attachedCount;
 }
@@ -713,7 +710,7 @@ int AttachEffectClass::DetachTypes(TechnoClass* pTarget, AEAttachInfoTypeClass c
 		pTargetExt->RecalculateStatMultipliers();
 
 	if (markForRedraw)
-		pTarget->MarkForRedraw();
+		pTargetExt->UpdateCustomTint();
 
 	return detachedCount;
 }
@@ -743,7 +740,6 @@ int AttachEffectClass::RemoveAllOfType(AttachEffectTypeClass* pType, TechnoClass
 
 	auto const targetAEs = &pTargetExt->AttachedEffects;
 	std::vector<std::unique_ptr<AttachEffectClass>>::iterator it;
-	std::vector<WeaponTypeClass*> expireWeapons;
 
 	for (it = targetAEs->begin(); it != targetAEs->end(); )
 	{
@@ -759,7 +755,7 @@ int AttachEffectClass::RemoveAllOfType(AttachEffectTypeClass* pType, TechnoClass
 			if (pType->ExpireWeapon && (pType->ExpireWeapon_TriggerOn & ExpireWeaponCondition::Remove) != ExpireWeaponCondition::None)
 			{
 				if (!pType->Cumulative || !pType->ExpireWeapon_CumulativeOnlyOnce || pTargetExt->GetAttachedEffectCumulativeCount(pType) < 2)
-					expireWeapons.push_back(pType->ExpireWeapon);
+					WeaponTypeExt::QueueDetonation(pType->ExpireWeapon, pTarget->GetCoords(), pTarget, pTarget->Owner, pTarget);
 			}
 
 			if (pType->Cumulative && pType->CumulativeAnimations.size() > 0)
@@ -779,14 +775,7 @@ int AttachEffectClass::RemoveAllOfType(AttachEffectTypeClass* pType, TechnoClass
 		}
 	}
 
-
-	auto const coords = pTarget->GetCoords();
-	auto const pOwner = pTarget->Owner;
-
-	for (auto const& pWeapon : expireWeapons)
-	{
-		WeaponTypeExt::DetonateAt(pWeapon, coords, pTarget, pOwner, pTarget);
-	}
+	WeaponTypeExt::FlushDetonations();
 
 	return detachedCount;
 }
@@ -850,6 +839,11 @@ void AttachEffectClass::TransferAttachedEffects(TechnoClass* pSource, TechnoClas
 
 		it = pSourceExt->AttachedEffects.erase(it);
 	}
+
+	pSourceExt->RecalculateStatMultipliers();
+	pTargetExt->RecalculateStatMultipliers();
+	pSourceExt->UpdateCustomTint();
+	pTargetExt->UpdateCustomTint();
 }
 
 #pragma endregion
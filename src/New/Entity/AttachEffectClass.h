@@ -95,6 +95,10 @@ struct AttachEffectTechnoProperties
 	bool ReflectDamage;
 	bool HasOnFireDiscardables;
 	bool HasRestrictedArmorMultipliers;
+	bool HasRevengeWeapon;
+	bool HasCritModifiers;
+	bool HasDeathExpireWeapon; // Checked on all attached effects, not only active ones.
+	size_t RangeModifierSignature; // Combined from active weapon range modifying types, changes invalidate cached weapon ranges.
 
 	AttachEffectTechnoProperties() :
 		FirepowerMultiplier { 1.0 }
@@ -109,5 +113,9 @@ struct AttachEffectTechnoProperties
 		, ReflectDamage { false }
 		, HasOnFireDiscardables { false }
 		, HasRestrictedArmorMultipliers { false }
+		, HasRevengeWeapon { false }
+		, HasCritModifiers { false }
+		, HasDeathExpireWeapon { false }
+		, RangeModifierSignature { 0 }
 	{ }
 };
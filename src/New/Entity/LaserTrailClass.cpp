@@ -1,7 +1,14 @@
 #include "LaserTrailClass.h"
 
+#include <Utilities/Macro.h>
+#include <Utilities/Profiler.h>
 #include <Utilities/TemplateDef.h>
 
+std::vector<LaserTrailClass::Segment> LaserTrailClass::Segments;
+LaserDrawClass* LaserTrailClass::SegmentBrush = nullptr;
+
+DEFINE_PROFILE_SECTION(Profile_LaserTrails, "LaserTrailClass::DrawAll");
+
 // Draws LaserTrail if the conditions are suitable.
 // Returns true if drawn, false otherwise.
 bool LaserTrailClass::Update(CoordStruct location)
@@ -17,15 +24,9 @@ bool LaserTrailClass::Update(CoordStruct location)
 	{
 		if (this->Visible && !this->Cloaked && (this->Type->IgnoreVertical ? (abs(location.X - this->LastLocation.Get().X) > 16 || abs(location.Y - this->LastLocation.Get().Y) > 16) : true))
 		{
-			// We spawn new laser segment if the distance is long enough, the game will do the rest - Kerbiter
-			LaserDrawClass* pLaser = GameCreate<LaserDrawClass>(
-				this->LastLocation.Get(), location,
-				this->CurrentColor, ColorStruct { 0, 0, 0 }, ColorStruct { 0, 0, 0 },
-				this->Type->FadeDuration.Get());
-
-			pLaser->Thickness = this->Type->Thickness;
-			pLaser->IsHouseColor = true;
-			pLaser->IsSupported = this->Type->IsIntense;
+			// We spawn new laser segment if the distance is long enough, DrawAll will do the rest - Kerbiter
+			LaserTrailClass::AddSegment(this->LastLocation.Get(), location, this->CurrentColor,
+				this->Type->Thickness, this->Type->IsIntense, this->Type->FadeDuration.Get());
 
 			result = true;
 		}
@@ -36,6 +37,80 @@ bool LaserTrailClass::Update(CoordStruct location)
 	return result;
 }
 
+void LaserTrailClass::AddSegment(const CoordStruct& source, const CoordStruct& target, ColorStruct color, int thickness, bool isSupported, int duration)
+{
+	if (duration <= 0)
+		return;
+
+	Segments.push_back({ source, target, color, thickness, isSupported, Unsorted::CurrentFrame, duration });
+}
+
+// Fades and draws all pooled trail segments in a single pass, dropping the expired ones in place.
+void LaserTrailClass::DrawAll()
+{
+	PROFILE_SCOPE(Profile_LaserTrails);
+
+	if (Segments.empty())
+		return;
+
+	if (!SegmentBrush)
+	{
+		// A single detached laser is reused to draw every segment so the game doesn't update or delete it on its own.
+		SegmentBrush = GameCreate<LaserDrawClass>(CoordStruct::Empty, CoordStruct::Empty,
+			ColorStruct { 0, 0, 0 }, ColorStruct { 0, 0, 0 }, ColorStruct { 0, 0, 0 }, 1);
+
+		LaserDrawClass::Array->Remove(SegmentBrush);
+		SegmentBrush->IsHouseColor = true;
+		SegmentBrush->Fades = false;
+	}
+
+	const int currentFrame = Unsorted::CurrentFrame;
+	auto const pBrush = SegmentBrush;
+	size_t alive = 0;
+
+	for (size_t i = 0; i < Segments.size(); ++i)
+	{
+		auto const& segment = Segments[i];
+		const int elapsed = currentFrame - segment.CreationFrame;
+
+		if (elapsed >= segment.Duration || elapsed < 0)
+			continue;
+
+		const double mult = 1.0 - static_cast<double>(elapsed) / segment.Duration;
+
+		pBrush->Source = segment.Source;
+		pBrush->Target = segment.Target;
+		pBrush->Thickness = segment.Thickness;
+		pBrush->IsSupported = segment.IsSupported;
+		pBrush->InnerColor = ColorStruct
+		{
+			static_cast<BYTE>(segment.Color.R * mult),
+			static_cast<BYTE>(segment.Color.G * mult),
+			static_cast<BYTE>(segment.Color.B * mult)
+		};
+
+		pBrush->DrawInHouseColor();
+
+		if (alive != i)
+			Segments[alive] = segment;
+
+		++alive;
+	}
+
+	Segments.resize(alive);
+}
+
+void LaserTrailClass::Clear()
+{
+	Segments.clear();
+}
+
+DEFINE_HOOK(0x6D4684, TacticalClass_Draw_LaserTrails, 0x6)
+{
+	LaserTrailClass::DrawAll();
+	return 0;
+}
+
 #pragma region Save/Load
 
 template <typename T>
@@ -2,6 +2,7 @@
 
 #include <GeneralStructures.h>
 #include <HouseClass.h>
+#include <LaserDrawClass.h>
 
 #include <New/Type/LaserTrailTypeClass.h>
 
@@ -46,7 +47,28 @@ public:
 	bool Load(PhobosStreamReader& stm, bool registerForChange);
 	bool Save(PhobosStreamWriter& stm) const;
 
+	static void DrawAll();
+	static void Clear();
+
 private:
 	template <typename T>
 	bool Serialize(T& stm);
+
+	// Trail segments are kept in a contiguous pool and drawn in one batch per frame
+	// instead of each one being a separate LaserDrawClass object.
+	struct Segment
+	{
+		CoordStruct Source;
+		CoordStruct Target;
+		ColorStruct Color;
+		int Thickness;
+		bool IsSupported;
+		int CreationFrame;
+		int Duration;
+	};
+
+	static std::vector<Segment> Segments;
+	static LaserDrawClass* SegmentBrush;
+
+	static void AddSegment(const CoordStruct& source, const CoordStruct& target, ColorStruct color, int thickness, bool isSupported, int duration);
 };
@@ -7,6 +7,7 @@
 #include <Ext/WarheadType/Body.h>
 
 #include <Utilities/GeneralUtils.h>
+#include <Utilities/Profiler.h>
 #include <AnimClass.h>
 #include <HouseClass.h>
 #include <RadarEventClass.h>
@@ -44,6 +45,8 @@ ShieldClass::ShieldClass(TechnoClass* pTechno, bool isAttached)
 
 ShieldClass::~ShieldClass()
 {
+	TEventExt::Publish(PhobosTriggerInput::ShieldState);
+
 	auto it = std::find(ShieldClass::Array.begin(), ShieldClass::Array.end(), this);
 
 	if (it != ShieldClass::Array.end())
@@ -125,10 +128,14 @@ void ShieldClass::SyncShieldToAnother(TechnoClass* pFrom, TechnoClass* pTo)
 		pToExt->Shield->TechnoID = pFromExt->Shield->TechnoID;
 		pToExt->Shield->Available = pFromExt->Shield->Available;
 		pToExt->Shield->HP = pFromExt->Shield->HP;
+		pToExt->UpdateCustomTint();
 	}
 
 	if (pFrom->WhatAmI() == AbstractType::Building && pFromExt->Shield)
+	{
 		pFromExt->Shield = nullptr;
+		pFromExt->UpdateCustomTint();
+	}
 }
 
 bool ShieldClass::ShieldIsBrokenTEvent(ObjectClass* pAttached)
@@ -408,6 +415,7 @@ void ShieldClass::AI()
 		if (auto pTechnoExt = TechnoExt::ExtMap.Find(this->Techno))
 		{
 			pTechnoExt->Shield = nullptr;
+			pTechnoExt->UpdateCustomTint();
 			return;
 		}
 	}
@@ -479,12 +487,13 @@ void ShieldClass::OnlineCheck()
 
 	if (!isActive)
 	{
-		if (this->Online)
-			this->UpdateTint();
-
+		bool wasOnline = this->Online;
 		this->Online = false;
 		timer->Pause();
 
+		if (wasOnline)
+			this->UpdateTint();
+
 		if (this->IdleAnim)
 		{
 			switch (this->Type->IdleAnim_OfflineAction)
@@ -510,12 +519,13 @@ void ShieldClass::OnlineCheck()
 	}
 	else
 	{
-		if (!this->Online)
-			this->UpdateTint();
-
+		bool wasOnline = this->Online;
 		this->Online = true;
 		timer->Resume();
 
+		if (!wasOnline)
+			this->UpdateTint();
+
 		if (this->IdleAnim)
 		{
 			this->IdleAnim->UnderTemporal = false;
@@ -560,7 +570,7 @@ bool ShieldClass::ConvertCheck()
 		this->KillAnim();
 		pTechnoExt->CurrentShieldType = ShieldTypeClass::FindOrAllocate(NONE_STR);
 		pTechnoExt->Shield = nullptr;
-		this->UpdateTint();
+		pTechnoExt->UpdateCustomTint(); // This shield is gone at this point.
 
 		return true;
 	}
@@ -604,6 +614,7 @@ bool ShieldClass::ConvertCheck()
 
 	this->TechnoID = newID;
 	this->UpdateTint();
+	TEventExt::Publish(PhobosTriggerInput::ShieldState);
 
 	return false;
 }
@@ -674,6 +685,7 @@ int ShieldClass::GetPercentageAmount(double iStatus)
 void ShieldClass::BreakShield(AnimTypeClass* pBreakAnim, WeaponTypeClass* pBreakWeapon)
 {
 	this->HP = 0;
+	TEventExt::Publish(PhobosTriggerInput::ShieldState);
 
 	if (this->Type->Respawn)
 		this->Timers.Respawn.Start(Timers.Respawn_WHModifier.InProgress() ? Respawn_Rate_Warhead : this->Type->Respawn_Rate);
@@ -713,6 +725,7 @@ void ShieldClass::RespawnShield()
 		double amount = timerWHModifier->InProgress() ? Respawn_Warhead : this->Type->Respawn;
 		this->HP = this->GetPercentageAmount(amount);
 		this->UpdateTint();
+		TEventExt::Publish(PhobosTriggerInput::ShieldState);
 	}
 	else if (timerWHModifier->Completed() && timer->InProgress())
 	{
@@ -805,8 +818,9 @@ void ShieldClass::UpdateIdleAnim()
 
 void ShieldClass::UpdateTint()
 {
-	if (this->Type->HasTint())
-		this->Techno->MarkForRedraw();
+	// Not checking Type->HasTint() as the previous type might have had one.
+	if (auto const pTechnoExt = TechnoExt::ExtMap.Find(this->Techno))
+		pTechnoExt->UpdateCustomTint();
 }
 
 AnimTypeClass* ShieldClass::GetIdleAnimType()
@@ -834,8 +848,13 @@ bool ShieldClass::IsRedSP()
 	return this->HP <= this->Type->GetConditionYellow() * this->Type->Strength.Get();
 }
 
+DEFINE_PROFILE_SECTION(Profile_DrawShieldBar_Building, "ShieldClass::DrawShieldBar_Building");
+DEFINE_PROFILE_SECTION(Profile_DrawShieldBar_Other, "ShieldClass::DrawShieldBar_Other");
+
 void ShieldClass::DrawShieldBar_Building(const int length, RectangleStruct* pBound)
 {
+	PROFILE_SCOPE(Profile_DrawShieldBar_Building);
+
 	Point2D position = { 0, 0 };
 	const int totalLength = DrawShieldBar_PipAmount(length);
 	int frame = this->DrawShieldBar_Pip(true);
@@ -865,16 +884,16 @@ void ShieldClass::DrawShieldBar_Building(const int length, RectangleStruct* pBou
 			position.X -= deltaX + 6;
 			position.Y -= deltaY + 3;
 
-			const int emptyFrame = this->Type->Pips_Building_Empty.Get(RulesExt::Global()->Pips_Shield_Building_Empty.Get(0));
-
 			DSurface::Temp->DrawSHP(FileSystem::PALETTE_PAL, FileSystem::PIPS_SHP,
-				emptyFrame, &position, pBound, BlitterFlags(0x600), 0, 0, ZGradient::Ground, 1000, 0, 0, 0, 0, 0);
+				this->Type->PipFrame_Building_Empty, &position, pBound, BlitterFlags(0x600), 0, 0, ZGradient::Ground, 1000, 0, 0, 0, 0, 0);
 		}
 	}
 }
 
 void ShieldClass::DrawShieldBar_Other(const int length, RectangleStruct* pBound)
 {
+	PROFILE_SCOPE(Profile_DrawShieldBar_Other);
+
 	auto position = TechnoExt::GetFootSelectBracketPosition(Techno, Anchor(HorizontalPosition::Left, VerticalPosition::Top));
 	const auto pipBoard = this->Type->Pips_Background.Get(RulesExt::Global()->Pips_Shield_Background.Get(FileSystem::PIPBRD_SHP()));
 	int frame;
@@ -910,24 +929,15 @@ void ShieldClass::DrawShieldBar_Other(const int length, RectangleStruct* pBound)
 int ShieldClass::DrawShieldBar_Pip(const bool isBuilding) const
 {
 	const int strength = this->Type->Strength.Get();
-	const auto pipsShield = isBuilding ? this->Type->Pips_Building.Get() : this->Type->Pips.Get();
-	const auto pipsGlobal = isBuilding ? RulesExt::Global()->Pips_Shield_Building.Get() : RulesExt::Global()->Pips_Shield.Get();
-
-	CoordStruct shieldPip;
-
-	if (pipsShield.X != -1)
-		shieldPip = pipsShield;
-	else
-		shieldPip = pipsGlobal;
+	this->Type->ResolvePipFrames();
+	const auto& pipFrames = isBuilding ? this->Type->PipFrames_Building : this->Type->PipFrames;
 
-	if (this->HP > this->Type->GetConditionYellow() * strength && shieldPip.X != -1)
-		return shieldPip.X;
-	else if (this->HP > this->Type->GetConditionRed() * strength && (shieldPip.Y != -1 || shieldPip.X != -1))
-		return shieldPip.Y == -1 ? shieldPip.X : shieldPip.Y;
-	else if (shieldPip.Z != -1 || shieldPip.X != -1)
-		return shieldPip.Z == -1 ? shieldPip.X : shieldPip.Z;
+	if (this->HP > this->Type->GetConditionYellow() * strength)
+		return pipFrames.X;
+	else if (this->HP > this->Type->GetConditionRed() * strength)
+		return pipFrames.Y;
 
-	return isBuilding ? 5 : 16;
+	return pipFrames.Z;
 }
 
 int ShieldClass::DrawShieldBar_PipAmount(int length) const
@@ -3,6 +3,7 @@
 #include <GeneralStructures.h>
 #include <SpecificStructures.h>
 #include <Ext/TechnoType/Body.h>
+#include <Ext/TEvent/Body.h>
 
 class TechnoClass;
 class WarheadTypeClass;
@@ -37,6 +38,7 @@ public:
 	void SetHP(int amount)
 	{
 		this->HP = std::min(amount, this->Type->Strength.Get());
+		TEventExt::Publish(PhobosTriggerInput::ShieldState);
 	}
 	int GetHP() const
 	{
@@ -26,6 +26,31 @@ double ShieldTypeClass::GetConditionRed() const
 	return this->ConditionRed.Get(RulesExt::Global()->Shield_ConditionRed.Get(RulesClass::Instance->ConditionRed));
 }
 
+static Vector3D<int> ResolveShieldPipFrames(const Vector3D<int>& pipsShield, const Vector3D<int>& pipsGlobal, int defaultFrame)
+{
+	const auto& pips = pipsShield.X != -1 ? pipsShield : pipsGlobal;
+
+	// Each condition falls back to the other set frames in the same order the pips used to be resolved when drawn.
+	const int green = pips.X != -1 ? pips.X : pips.Y != -1 ? pips.Y : pips.Z != -1 ? pips.Z : defaultFrame;
+	const int yellow = pips.Y != -1 ? pips.Y : pips.X != -1 ? pips.X : pips.Z != -1 ? pips.Z : defaultFrame;
+	const int red = pips.Z != -1 ? pips.Z : pips.X != -1 ? pips.X : defaultFrame;
+
+	return { green, yellow, red };
+}
+
+void ShieldTypeClass::ResolvePipFrames()
+{
+	if (this->PipFrames_Generation == RulesExt::PipLayoutGeneration)
+		return;
+
+	this->PipFrames_Generation = RulesExt::PipLayoutGeneration;
+	auto const pRulesExt = RulesExt::Global();
+
+	this->PipFrames = ResolveShieldPipFrames(this->Pips.Get(), pRulesExt->Pips_Shield.Get(), 16);
+	this->PipFrames_Building = ResolveShieldPipFrames(this->Pips_Building.Get(), pRulesExt->Pips_Shield_Building.Get(), 5);
+	this->PipFrame_Building_Empty = this->Pips_Building_Empty.Get(pRulesExt->Pips_Shield_Building_Empty.Get(0));
+}
+
 void ShieldTypeClass::LoadFromINI(CCINIClass* pINI)
 {
 	const char* pSection = this->Name;
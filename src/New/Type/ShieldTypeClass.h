@@ -49,6 +49,12 @@ public:
 	Nullable<SHPStruct*> Pips_Background;
 	Valueable<Vector3D<int>> Pips_Building;
 	Nullable<int> Pips_Building_Empty;
+
+	// Green / yellow / red pip frames resolved against [AudioVisual] defaults on first draw, see ResolvePipFrames().
+	Vector3D<int> PipFrames;
+	Vector3D<int> PipFrames_Building;
+	int PipFrame_Building_Empty;
+	int PipFrames_Generation;
 	Valueable<bool> ImmuneToCrit;
 	Valueable<bool> ImmuneToBerserk;
 
@@ -95,6 +101,10 @@ public:
 		, Pips_Background { }
 		, Pips_Building { { -1,-1,-1 } }
 		, Pips_Building_Empty { }
+		, PipFrames { 16, 16, 16 }
+		, PipFrames_Building { 5, 5, 5 }
+		, PipFrame_Building_Empty { 0 }
+		, PipFrames_Generation { -1 }
 		, ImmuneToBerserk { false }
 		, ImmuneToCrit { false }
 		, Tint_Color {}
@@ -114,6 +124,7 @@ public:
 	AnimTypeClass* GetIdleAnimType(bool isDamaged, double healthRatio) const;
 	double GetConditionYellow() const;
 	double GetConditionRed() const;
+	void ResolvePipFrames();
 
 private:
 	template <typename T>
@@ -19,6 +19,7 @@
 #include <Ext/Side/Body.h>
 #include <Ext/SWType/Body.h>
 #include <Ext/TAction/Body.h>
+#include <Ext/TEvent/Body.h>
 #include <Ext/Team/Body.h>
 #include <Ext/Techno/Body.h>
 #include <Ext/TechnoType/Body.h>
@@ -32,6 +33,7 @@
 #include <New/Type/RadTypeClass.h>
 #include <New/Type/LaserTrailTypeClass.h>
 #include <New/Type/DigitalDisplayTypeClass.h>
+#include <New/Entity/LaserTrailClass.h>
 
 #include <utility>
 
@@ -213,6 +215,7 @@ using PhobosTypeRegistry = TypeRegistry <
 	SideExt,
 	SWTypeExt,
 	TActionExt,
+	TEventExt,
 	TeamExt,
 	TechnoExt,
 	TechnoTypeExt,
@@ -229,7 +232,8 @@ using PhobosTypeRegistry = TypeRegistry <
 	ShieldClass,
 	DigitalDisplayTypeClass,
 	AttachEffectTypeClass,
-	AttachEffectClass
+	AttachEffectClass,
+	LaserTrailClass
 	// other classes
 > ;
 
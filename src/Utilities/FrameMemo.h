@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Unsorted.h>
+
+#include <Utilities/Profiler.h>
+
+// Per-object cache slot for predicates that are queried from several places in the same frame.
+// The slot is stamped with the frame it was computed on and recomputed once the frame counter
+// moves on, so no clearing pass over all objects is needed. An optional key covers predicates
+// that depend on one extra input (for example the movement zone the question was asked for).
+// Values are never saved, a loaded game simply starts with empty slots.
+
+template <typename TValue, typename TKey = bool>
+class FrameMemo
+{
+public:
+	FrameMemo() : Frame { -1 }, Key {}, Value {}
+	{ }
+
+	template <typename Func>
+	TValue Get(const TKey& key, Func&& compute, ProfileSection& hits, ProfileSection& misses)
+	{
+		const int currentFrame = Unsorted::CurrentFrame;
+
+		if (this->Frame == currentFrame && this->Key == key)
+		{
+			PROFILE_COUNT(hits);
+			return this->Value;
+		}
+
+		PROFILE_COUNT(misses);
+		this->Value = compute();
+		this->Key = key;
+		this->Frame = currentFrame;
+		return this->Value;
+	}
+
+	template <typename Func>
+	TValue Get(Func&& compute, ProfileSection& hits, ProfileSection& misses)
+	{
+		return this->Get(TKey {}, std::forward<Func>(compute), hits, misses);
+	}
+
+private:
+	int Frame;
+	TKey Key;
+	TValue Value;
+};
@@ -5,6 +5,7 @@
 #include <BitFont.h>
 
 #include <Ext/Rules/Body.h>
+#include <Ext/WarheadType/Body.h>
 #include <Misc/FlyingStrings.h>
 #include <Utilities/Constructs.h>
 
@@ -71,7 +72,16 @@ const double GeneralUtils::GetRangedRandomOrSingleValue(PartialVector2D<double>
 
 const double GeneralUtils::GetWarheadVersusArmor(WarheadTypeClass* pWH, Armor ArmorType)
 {
-	return double(MapClass::GetTotalDamage(100, pWH, ArmorType, 0)) / 100.0;
+	const double versus = WarheadTypeExt::ExtMap.Find(pWH)->GetVersusArmor(ArmorType);
+
+#ifdef DEBUG
+	const double expected = double(MapClass::GetTotalDamage(100, pWH, ArmorType, 0)) / 100.0;
+
+	if (versus != expected)
+		Debug::Log("[Developer warning] Cached versus of warhead %s against armor %d is %f, expected %f.\n", pWH->ID, static_cast<int>(ArmorType), versus, expected);
+#endif
+
+	return versus;
 }
 
 // Weighted random element choice (weight) - roll for one.
@@ -183,11 +183,23 @@ namespace Helpers
 			}
 		}
 
-		//! Gets a list of all units in range of a cell spread weapon.
+		//! An object found while gathering the cells of a cell spread weapon.
 		/*!
-			CellSpread is handled as described in
-			http://modenc.renegadeprojects.com/CellSpread.
+			Candidates only depend on the cell the projectile detonated in and
+			the spread, the exact impact coordinates are applied afterwards by
+			selectCellSpreadItems.
+		*/
+		struct CellSpreadCandidate
+		{
+			TechnoClass* Techno;
+			CoordStruct CellCenter; // Buildings only, center of the cell they were found on.
+			bool IsCenterCell;      // Buildings only, found on the cell the projectile detonated in.
+			bool IsInAir;           // Found through the aircraft tracker.
+		};
 
+		//! Gathers everything a cell spread weapon detonating in a cell could hit.
+		/*!
+			\param candidates Receives the candidates, may contain duplicates.
 			\param coords The location the projectile detonated.
 			\param spread The range to find items in.
 			\param includeInAir Include items that are currently InAir.
@@ -198,13 +210,11 @@ namespace Helpers
 			\modifications by Starkku
 			\date 2024-05-20
 		*/
-		inline std::vector<TechnoClass*> getCellSpreadItems(
-			CoordStruct const& coords, double const spread,
-			bool const includeInAir = false)
+		inline void getCellSpreadCandidates(
+			std::vector<CellSpreadCandidate>& candidates, CoordStruct const& coords,
+			double const spread, bool const includeInAir = false)
 		{
-			// set of possibly affected objects. every object can be here only once.
-			DistinctCollector<TechnoClass*> set;
-			double const spreadMult = spread * Unsorted::LeptonsPerCell;
+			candidates.clear();
 
 			// the quick way. only look at stuff residing on the very cells we are affecting.
 			auto const cellCoords = MapClass::Instance->GetCellAt(coords)->MapCoords;
@@ -219,24 +229,9 @@ namespace Helpers
 					{
 						// Starkku: Buildings need their distance from the origin coords checked at cell level.
 						if (pTechno->WhatAmI() == AbstractType::Building)
-						{
-							auto const cellCenterCoords = pCell->GetCenterCoords();
-							double dist = cellCenterCoords.DistanceFrom(coords);
-
-							// If this is the center cell, there's some different behaviour.
-							if (isCenter)
-							{
-								if (coords.Z - cellCenterCoords.Z <= Unsorted::LevelHeight)
-									dist = 0;
-								else
-									dist -= Unsorted::LevelHeight;
-							}
-
-							if (dist > spreadMult)
-								continue;
-						}
-
-						set.insert(pTechno);
+							candidates.push_back({ pTechno, pCell->GetCenterCoords(), isCenter, false });
+						else
+							candidates.push_back({ pTechno, CoordStruct::Empty, false, false });
 					}
 				}
 			}
@@ -251,33 +246,71 @@ namespace Helpers
 				for (auto pTechno = airTracker->Get(); pTechno; pTechno = airTracker->Get())
 				{
 					if (pTechno->IsAlive && pTechno->IsOnMap && pTechno->Health > 0)
+						candidates.push_back({ pTechno, CoordStruct::Empty, false, true });
+				}
+			}
+		}
+
+		//! Picks the candidates actually affected by a cell spread weapon.
+		/*!
+			Items are ordered the same way DistinctCollector orders them.
+
+			\param items Receives the affected items.
+			\param candidates Gathered by getCellSpreadCandidates for the same cell and spread.
+			\param coords The location the projectile detonated.
+			\param spread The range to find items in.
+		*/
+		inline void selectCellSpreadItems(
+			std::vector<TechnoClass*>& items, std::vector<CellSpreadCandidate> const& candidates,
+			CoordStruct const& coords, double const spread)
+		{
+			items.clear();
+			double const spreadMult = spread * Unsorted::LeptonsPerCell;
+
+			for (auto const& candidate : candidates)
+			{
+				auto const pTechno = candidate.Techno;
+
+				if (candidate.IsInAir)
+				{
+					if (pTechno->Location.DistanceFrom(coords) > spreadMult)
+						continue;
+				}
+				else if (pTechno->WhatAmI() == AbstractType::Building)
+				{
+					double dist = candidate.CellCenter.DistanceFrom(coords);
+
+					// If this is the center cell, there's some different behaviour.
+					if (candidate.IsCenterCell)
 					{
-						if (pTechno->Location.DistanceFrom(coords) <= spreadMult)
-						{
-							set.insert(pTechno);
-						}
+						if (coords.Z - candidate.CellCenter.Z <= Unsorted::LevelHeight)
+							dist = 0;
+						else
+							dist -= Unsorted::LevelHeight;
 					}
+
+					if (dist > spreadMult)
+						continue;
 				}
+
+				items.push_back(pTechno);
 			}
 
-			// look closer. the final selection. put all affected items in a vector.
-			std::vector<TechnoClass*> ret;
-			ret.reserve(set.size());
+			// every object can be here only once, in the same order a DistinctCollector would give.
+			std::sort(items.begin(), items.end(), deref_less());
+			items.erase(std::unique(items.begin(), items.end(),
+				[](TechnoClass* const pLeft, TechnoClass* const pRight) { return !deref_less()(pLeft, pRight); }), items.end());
 
-			for (auto const& pTechno : set)
+			// look closer. the final selection. keep all affected items.
+			items.erase(std::remove_if(items.begin(), items.end(), [&coords, spreadMult](TechnoClass* const pTechno)
 			{
 				auto const abs = pTechno->WhatAmI();
-				bool isBuilding = false;
 
 				// ignore buildings that are not visible, like ambient light posts
 				if (abs == AbstractType::Building)
 				{
-					auto const pBuilding = static_cast<BuildingClass*>(pTechno);
-					if (pBuilding->Type->InvisibleInGame)
-					{
-						continue;
-					}
-					isBuilding = true;
+					// Starkku: Building distance is checked prior on cell level, skip here.
+					return static_cast<BuildingClass*>(pTechno)->Type->InvisibleInGame;
 				}
 
 				// get distance from impact site
@@ -291,16 +324,94 @@ namespace Helpers
 				}
 
 				// this is good
-				// Starkku: Building distance is checked prior on cell level, skip here.
-				if (isBuilding || dist <= spreadMult)
-				{
-					ret.push_back(pTechno);
-				}
-			}
+				return dist > spreadMult;
+			}), items.end());
+		}
 
+		//! Gets a list of all units in range of a cell spread weapon.
+		/*!
+			CellSpread is handled as described in
+			http://modenc.renegadeprojects.com/CellSpread.
+
+			The items are written into a caller supplied buffer, which is cleared
+			first, so callers that detonate often can reuse its storage.
+
+			\param items Receives the affected items.
+			\param coords The location the projectile detonated.
+			\param spread The range to find items in.
+			\param includeInAir Include items that are currently InAir.
+		*/
+		inline void getCellSpreadItems(
+			std::vector<TechnoClass*>& items, CoordStruct const& coords,
+			double const spread, bool const includeInAir = false)
+		{
+			// nothing runs between gathering and selecting, so the scratch storage can be shared.
+			static std::vector<CellSpreadCandidate> candidates;
+			getCellSpreadCandidates(candidates, coords, spread, includeInAir);
+			selectCellSpreadItems(items, candidates, coords, spread);
+		}
+
+		//! Gets a list of all units in range of a cell spread weapon.
+		/*!
+			Convenience overload returning a new vector, see the overload above.
+
+			\param coords The location the projectile detonated.
+			\param spread The range to find items in.
+			\param includeInAir Include items that are currently InAir.
+		*/
+		inline std::vector<TechnoClass*> getCellSpreadItems(
+			CoordStruct const& coords, double const spread,
+			bool const includeInAir = false)
+		{
+			std::vector<TechnoClass*> ret;
+			getCellSpreadItems(ret, coords, spread, includeInAir);
 			return ret;
 		}
 
+		//! Reusable result storage for getCellSpreadItems.
+		/*!
+			Detonations can nest (a target dying may detonate another warhead while
+			the outer one still iterates its targets), so every caller borrows its
+			own buffer from a pool for as long as it is in scope and returns it,
+			capacity included, afterwards.
+		*/
+		class CellSpreadBuffer
+		{
+		public:
+			CellSpreadBuffer() : Items { Acquire() }
+			{ }
+
+			~CellSpreadBuffer()
+			{
+				this->Items.clear();
+				Pool().push_back(std::move(this->Items));
+			}
+
+			CellSpreadBuffer(const CellSpreadBuffer&) = delete;
+			CellSpreadBuffer& operator=(const CellSpreadBuffer&) = delete;
+
+			std::vector<TechnoClass*> Items;
+
+		private:
+			static std::vector<std::vector<TechnoClass*>>& Pool()
+			{
+				static std::vector<std::vector<TechnoClass*>> pool;
+				return pool;
+			}
+
+			static std::vector<TechnoClass*> Acquire()
+			{
+				auto& pool = Pool();
+
+				if (pool.empty())
+					return {};
+
+				auto items = std::move(pool.back());
+				pool.pop_back();
+				return items;
+			}
+		};
+
 		//! Invokes an action for every cell or every object contained on the cells.
 		/*!
 			action is invoked only once per cell. action can be invoked multiple times
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <new>
+#include <typeinfo>
+#include <vector>
+
+// Free list backing class-level operator new / delete of objects that are created and destroyed at high
+// rates, like bullet extensions and their trajectories. Freed blocks are kept for the next object of the
+// same type instead of going back to the heap, so constructors and destructors still run as usual and
+// save games are not affected. Blocks are only ever handed out for exactly sizeof(T), anything else is
+// forwarded to the global allocator.
+
+class ObjectPoolStats
+{
+public:
+	const char* Name;
+	int Live;   // Objects currently allocated.
+	int Peak;   // Highest Live value seen.
+	int Blocks; // Blocks owned by the pool, live or free.
+
+	ObjectPoolStats(const char* pName) : Name { pName }, Live { 0 }, Peak { 0 }, Blocks { 0 }
+	{
+		All().push_back(this);
+	}
+
+	static std::vector<ObjectPoolStats*>& All()
+	{
+		static std::vector<ObjectPoolStats*> stats;
+		return stats;
+	}
+};
+
+template <typename T>
+class ObjectPool
+{
+public:
+	static void* Allocate(size_t size)
+	{
+		if (size != sizeof(T))
+			return ::operator new(size);
+
+		void* ptr = nullptr;
+
+		if (FreeList)
+		{
+			ptr = FreeList;
+			FreeList = FreeList->Next;
+		}
+		else
+		{
+			ptr = ::operator new(sizeof(T) < sizeof(FreeBlock) ? sizeof(FreeBlock) : sizeof(T));
+			++Stats.Blocks;
+		}
+
+		if (++Stats.Live > Stats.Peak)
+			Stats.Peak = Stats.Live;
+
+		return ptr;
+	}
+
+	static void Free(void* ptr, size_t size)
+	{
+		if (!ptr)
+			return;
+
+		if (size != sizeof(T))
+		{
+			::operator delete(ptr);
+			return;
+		}
+
+		auto const pBlock = static_cast<FreeBlock*>(ptr);
+		pBlock->Next = FreeList;
+		FreeList = pBlock;
+		--Stats.Live;
+	}
+
+	inline static ObjectPoolStats Stats { typeid(T).name() };
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock* Next;
+	};
+
+	inline static FreeBlock* FreeList = nullptr;
+};
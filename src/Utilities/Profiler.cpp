@@ -0,0 +1,115 @@
+#include "Profiler.h"
+
+#include <Utilities/Debug.h>
+#include <Utilities/Macro.h>
+#include <Utilities/ObjectPool.h>
+
+#include <algorithm>
+#include <cstdio>
+
+bool Profiler::Enabled = false;
+int Profiler::ProfiledFrames = 0;
+
+ProfileSection::ProfileSection(const char* pName) :
+	Name { pName }
+	, FrameCalls { 0 }
+	, FrameCycles { 0 }
+	, TotalCalls { 0 }
+	, TotalCycles { 0 }
+	, MaxFrameCycles { 0 }
+{
+	Profiler::Sections().push_back(this);
+}
+
+// Function-local so that sections defined in other translation units can register during static init.
+std::vector<ProfileSection*>& Profiler::Sections()
+{
+	static std::vector<ProfileSection*> sections;
+	return sections;
+}
+
+void Profiler::Start()
+{
+	for (auto const pSection : Sections())
+		pSection->Reset();
+
+	ProfiledFrames = 0;
+	Enabled = true;
+}
+
+void Profiler::Stop()
+{
+	NextFrame();
+	Enabled = false;
+}
+
+// Folds the counters of the frame that just ended into the totals.
+void Profiler::NextFrame()
+{
+	if (!Enabled)
+		return;
+
+	for (auto const pSection : Sections())
+	{
+		pSection->TotalCalls += pSection->FrameCalls;
+		pSection->TotalCycles += pSection->FrameCycles;
+		pSection->MaxFrameCycles = std::max(pSection->MaxFrameCycles, pSection->FrameCycles);
+		pSection->FrameCalls = 0;
+		pSection->FrameCycles = 0;
+	}
+
+	++ProfiledFrames;
+}
+
+void Profiler::Dump(const char* pFilename)
+{
+	auto sections = Sections();
+
+	std::sort(sections.begin(), sections.end(), [](ProfileSection* pLeft, ProfileSection* pRight)
+		{
+			return pLeft->TotalCycles > pRight->TotalCycles;
+		});
+
+	const unsigned __int64 frames = std::max(ProfiledFrames, 1);
+
+	Debug::Log("Profiler results over %d frames:\n", ProfiledFrames);
+
+	for (auto const pSection : sections)
+	{
+		if (!pSection->TotalCalls)
+			continue;
+
+		Debug::Log("  %-48s calls/frame: %10.2f | cycles/frame: %12llu | max cycles/frame: %12llu\n",
+			pSection->Name, static_cast<double>(pSection->TotalCalls) / frames, pSection->TotalCycles / frames, pSection->MaxFrameCycles);
+	}
+
+	for (auto const pStats : ObjectPoolStats::All())
+		Debug::Log("  Pool %-43s live: %6d | peak: %6d | blocks: %6d\n", pStats->Name, pStats->Live, pStats->Peak, pStats->Blocks);
+
+	auto const pFile = fopen(pFilename, "wt");
+
+	if (!pFile)
+	{
+		Debug::Log("Failed to open profiler output file '%s'.\n", pFilename);
+		return;
+	}
+
+	fprintf(pFile, "Section,Frames,Calls,Cycles,CallsPerFrame,CyclesPerFrame,MaxCyclesPerFrame,CyclesPerCall\n");
+
+	for (auto const pSection : sections)
+	{
+		fprintf(pFile, "%s,%d,%llu,%llu,%.2f,%llu,%llu,%llu\n",
+			pSection->Name, ProfiledFrames, pSection->TotalCalls, pSection->TotalCycles,
+			static_cast<double>(pSection->TotalCalls) / frames, pSection->TotalCycles / frames, pSection->MaxFrameCycles,
+			pSection->TotalCalls ? pSection->TotalCycles / pSection->TotalCalls : 0);
+	}
+
+	fclose(pFile);
+	Debug::Log("Profiler results written to '%s'.\n", pFilename);
+}
+
+DEFINE_HOOK(0x55D360, MainLoop_Profiler_NextFrame, 0x5)
+{
+	Profiler::NextFrame();
+	return 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <intrin.h>
+#include <vector>
+
+// Lightweight RDTSC-based scope timers used to find out which Phobos hooks cost the most per frame.
+// Sections are declared once per hook with DEFINE_PROFILE_SECTION and measured with PROFILE_SCOPE.
+// In release builds PROFILE_SCOPE compiles to nothing, otherwise it costs a single branch while
+// the profiler is not running.
+
+class ProfileSection
+{
+public:
+	const char* Name;
+
+	// Counters for the frame currently being processed.
+	unsigned int FrameCalls;
+	unsigned __int64 FrameCycles;
+
+	// Aggregates over all profiled frames.
+	unsigned __int64 TotalCalls;
+	unsigned __int64 TotalCycles;
+	unsigned __int64 MaxFrameCycles;
+
+	ProfileSection(const char* pName);
+
+	void Reset()
+	{
+		this->FrameCalls = 0;
+		this->FrameCycles = 0;
+		this->TotalCalls = 0;
+		this->TotalCycles = 0;
+		this->MaxFrameCycles = 0;
+	}
+};
+
+class Profiler
+{
+public:
+	static bool Enabled;
+	static int ProfiledFrames;
+
+	static std::vector<ProfileSection*>& Sections();
+
+	static void Start();
+	static void Stop();
+	static void NextFrame();
+	static void Dump(const char* pFilename);
+
+	class ScopedTimer
+	{
+	public:
+		ScopedTimer(ProfileSection& section) :
+			Section { Profiler::Enabled ? &section : nullptr }
+			, StartCycles { Profiler::Enabled ? __rdtsc() : 0 }
+		{ }
+
+		~ScopedTimer()
+		{
+			if (this->Section)
+			{
+				++this->Section->FrameCalls;
+				this->Section->FrameCycles += __rdtsc() - this->StartCycles;
+			}
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		ProfileSection* Section;
+		unsigned __int64 StartCycles;
+	};
+};
+
+#define DEFINE_PROFILE_SECTION(var, name) static ProfileSection var { name }
+
+// PROFILE_COUNT only counts calls without timing, for sections used as per-frame event counters.
+#ifndef IS_RELEASE_VER
+#define PROFILE_SCOPE(section) Profiler::ScopedTimer _profileScope_##section { section }
+#define PROFILE_COUNT(section) do { if (Profiler::Enabled) ++(section).FrameCalls; } while (0)
+#else
+#define PROFILE_SCOPE(section)
+#define PROFILE_COUNT(section)
+#endif